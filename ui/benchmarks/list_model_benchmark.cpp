@@ -0,0 +1,144 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Times reset/insert/update/remove of the list models used by the wallet views.
+// Usage: list_model_benchmark [rows...], defaults to 1000 10000 100000
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <QElapsedTimer>
+
+#include "viewmodel/helpers/keyed_list_model.h"
+
+namespace
+{
+    struct Row
+    {
+        uint64_t id = 0;
+        uint64_t amount = 0;
+
+        bool operator==(const Row& other) const
+        {
+            return id == other.id;
+        }
+    };
+
+    using RowPtr = std::shared_ptr<Row>;
+    using Rows = std::vector<RowPtr>;
+
+    class PlainRows : public ListModel<RowPtr>
+    {
+    public:
+        QVariant data(const QModelIndex&, int) const override
+        {
+            return QVariant();
+        }
+    };
+
+    class KeyedRows : public KeyedListModel<RowPtr, uint64_t>
+    {
+    public:
+        QVariant data(const QModelIndex&, int) const override
+        {
+            return QVariant();
+        }
+
+    protected:
+        uint64_t keyOf(const RowPtr& row) const override
+        {
+            return row->id;
+        }
+    };
+
+    Rows makeRows(size_t count, uint64_t firstId)
+    {
+        Rows rows;
+        rows.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto row = std::make_shared<Row>();
+            row->id = firstId + i;
+            row->amount = i;
+            rows.push_back(std::move(row));
+        }
+        return rows;
+    }
+
+    // every 10th row, spread over the whole list like a status update after sync
+    Rows pickRows(const Rows& rows)
+    {
+        Rows picked;
+        for (size_t i = 0; i < rows.size(); i += 10)
+        {
+            auto row = std::make_shared<Row>(*rows[i]);
+            row->amount += 1;
+            picked.push_back(std::move(row));
+        }
+        std::shuffle(picked.begin(), picked.end(), std::mt19937(42));
+        return picked;
+    }
+
+    template<typename Model, typename Op>
+    double measure(Model& model, Op&& op)
+    {
+        QElapsedTimer timer;
+        timer.start();
+        op(model);
+        return timer.nsecsElapsed() / 1e6;
+    }
+
+    template<typename Model>
+    void run(const char* name, size_t count)
+    {
+        const auto rows = makeRows(count, 0);
+        const auto added = makeRows(count / 10, count);
+        const auto changed = pickRows(rows);
+
+        Model model;
+        auto reset = measure(model, [&](Model& m) { m.reset(rows); });
+        auto insert = measure(model, [&](Model& m) { m.insert(added); });
+        auto update = measure(model, [&](Model& m) { m.update(changed); });
+        auto remove = measure(model, [&](Model& m) { m.remove(changed); });
+
+        printf("%-16s %8zu rows  reset %10.3f ms  insert %10.3f ms  update %10.3f ms  remove %10.3f ms  (%zu changed)\n",
+               name, count, reset, insert, update, remove, changed.size());
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<size_t> sizes;
+    for (int i = 1; i < argc; ++i)
+    {
+        sizes.push_back(std::strtoull(argv[i], nullptr, 10));
+    }
+
+    if (sizes.empty())
+    {
+        sizes = { 1000, 10000, 100000 };
+    }
+
+    for (auto count : sizes)
+    {
+        run<PlainRows>("ListModel", count);
+        run<KeyedRows>("KeyedListModel", count);
+    }
+
+    return 0;
+}
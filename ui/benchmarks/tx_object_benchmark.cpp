@@ -0,0 +1,241 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the heap kept alive by each row of the transaction lists, for TxObject and for
+// the layout it had before, which copied the whole description and cached roles per row.
+// Usage: tx_object_benchmark [rows...], defaults to 1000 10000 100000
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include <QHash>
+#include <QVariant>
+#include "viewmodel/helpers/row_pool.h"
+#include "viewmodel/helpers/string_pool.h"
+#include "viewmodel/wallet/tx_object.h"
+
+namespace
+{
+    // bytes requested through operator new and not released yet
+    std::atomic<size_t> g_liveBytes{0};
+
+    // Qt allocates string and container buffers with malloc, only glibc can report those
+    size_t mallocBytes()
+    {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+        return mallinfo2().uordblks;
+#else
+        return 0;
+#endif
+    }
+
+    struct HeapSnapshot
+    {
+        size_t newBytes = g_liveBytes.load();
+        size_t heapBytes = mallocBytes();
+    };
+
+    const char* kDapps[] = { "Faucet", "DAO Core", "Minter", "BeamX", "Gallery", "Nephrite", "Vote", "Bridges" };
+
+    std::vector<beam::wallet::TxDescription> makeDescriptions(size_t count)
+    {
+        using namespace beam::wallet;
+
+        std::vector<TxDescription> txs(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto& tx = txs[i];
+            std::fill(tx.m_txId.begin(), tx.m_txId.end(), 0);
+            std::copy_n(reinterpret_cast<const uint8_t*>(&i), sizeof(i), tx.m_txId.begin());
+
+            // a few own addresses, peers are mostly distinct
+            tx.m_myAddr.m_Channel = static_cast<BbsChannel>(i % 4);
+            std::fill_n(tx.m_myAddr.m_Pk.m_pData, tx.m_myAddr.m_Pk.nBytes, static_cast<uint8_t>(i % 4 + 1));
+            tx.m_peerAddr.m_Channel = static_cast<BbsChannel>(i % 64);
+            std::copy_n(reinterpret_cast<const uint8_t*>(&i), sizeof(i), tx.m_peerAddr.m_Pk.m_pData);
+
+            tx.m_txType = TxType::Simple;
+            tx.m_status = i % 10 ? TxStatus::Completed : TxStatus::InProgress;
+            tx.m_sender = i % 2 == 0;
+            tx.m_amount = 1000000 + i;
+            tx.m_fee = 100000;
+            tx.m_assetId = static_cast<beam::Asset::ID>(i % 3);
+            tx.m_createTime = 1600000000 + i;
+            tx.m_minHeight = 1000000 + i;
+
+            const std::string comment = "payment #" + std::to_string(i);
+            tx.m_message.assign(comment.begin(), comment.end());
+
+            // every fifth row comes from a DApp, their names repeat
+            if (i % 5 == 0)
+            {
+                tx.m_appName = kDapps[i % std::size(kDapps)];
+                tx.SetParameter(TxParameterID::AppID, std::string("app-") + tx.m_appName);
+            }
+        }
+        return txs;
+    }
+
+    // TxObject members before it dropped the description copy, filled the way its constructor did,
+    // the role cache stays empty as it was until a view read the row
+    struct BaselineTxObject
+    {
+        explicit BaselineTxObject(const beam::wallet::TxDescription& tx)
+            : _tx(tx)
+            , _secondCurrency(beam::wallet::Currency::UNKNOWN())
+        {
+            using namespace beam::wallet;
+
+            _assetsList.push_back(_tx.m_assetId);
+            _assetAmounts.push_back(_tx.m_amount);
+            _assetAmountsIncome.push_back(!_tx.m_sender);
+
+            if (!_tx.m_appName.empty())
+            {
+                _source = StringPool::intern(QString::fromStdString(_tx.m_appName));
+            }
+            if (auto appId = _tx.GetParameter<std::string>(TxParameterID::AppID))
+            {
+                _appId = StringPool::intern(QString::fromStdString(*appId));
+            }
+        }
+
+        virtual ~BaselineTxObject() = default;
+
+        beam::wallet::TxDescription _tx;
+        beam::wallet::Currency _secondCurrency;
+        uint32_t _minConfirmations = 0;
+        beam::Amount _contractFee = 0UL;
+
+        QString _contractCids;
+        QString _source;
+        QString _appId;
+        mutable QString _comment;
+
+        beam::wallet::TxAddressType _addressType = beam::wallet::TxAddressType::Unknown;
+        TxUIStatus _uiStatus = TxUIStatus::Unknown;
+        uint8_t _flags = 0;
+
+        std::vector<beam::Asset::ID> _assetsList;
+        std::vector<beam::Amount>    _assetAmounts;
+        std::vector<bool>            _assetAmountsIncome;
+
+        mutable QHash<int, QVariant> _roleCache;
+        mutable uint32_t             _roleCacheGeneration = 0;
+    };
+
+    // rows are built the way TxObjectLoader builds them, from the pool
+    template <typename Row>
+    void measure(const char* name, const std::vector<beam::wallet::TxDescription>& descriptions)
+    {
+        const auto count = descriptions.size();
+
+        std::vector<std::shared_ptr<Row>> rows;
+        rows.reserve(count);
+
+        const HeapSnapshot before;
+        for (const auto& tx : descriptions)
+        {
+            if constexpr (std::is_same_v<Row, TxObject>)
+            {
+                rows.push_back(RowPool<Row>::make(tx, beam::wallet::Currency::UNKNOWN()));
+            }
+            else
+            {
+                rows.push_back(RowPool<Row>::make(tx));
+            }
+        }
+        const HeapSnapshot after;
+
+        printf("%8zu rows  %-8s  sizeof %4zu B  operator new %8.1f B/row",
+               count, name, sizeof(Row), double(after.newBytes - before.newBytes) / count);
+        if (after.heapBytes != 0)
+        {
+            printf("  heap %8.1f B/row", double(after.heapBytes - before.heapBytes) / count);
+        }
+        printf("\n");
+
+        rows.clear();
+        RowPool<Row>::nextGeneration();
+    }
+
+    void run(size_t count)
+    {
+        const auto descriptions = makeDescriptions(count);
+
+        measure<BaselineTxObject>("baseline", descriptions);
+        measure<TxObject>("TxObject", descriptions);
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    // the size is kept in front of the block, so operator delete can count it back
+    auto* block = static_cast<std::max_align_t*>(std::malloc(sizeof(std::max_align_t) + size));
+    if (!block)
+    {
+        throw std::bad_alloc();
+    }
+    *reinterpret_cast<size_t*>(block) = size;
+    g_liveBytes += size;
+    return block + 1;
+}
+
+void operator delete(void* p) noexcept
+{
+    if (!p)
+    {
+        return;
+    }
+    auto* block = static_cast<std::max_align_t*>(p) - 1;
+    g_liveBytes -= *reinterpret_cast<size_t*>(block);
+    std::free(block);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    operator delete(p);
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<size_t> sizes;
+    for (int i = 1; i < argc; ++i)
+    {
+        sizes.push_back(std::strtoull(argv[i], nullptr, 10));
+    }
+
+    if (sizes.empty())
+    {
+        sizes = { 1000, 10000, 100000 };
+    }
+
+    for (auto count : sizes)
+    {
+        run(count);
+    }
+
+    return 0;
+}
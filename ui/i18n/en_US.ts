@@ -1326,6 +1326,34 @@ Please check the swap token and try again.</translation>
         <extracomment>transaction history screen, export button tooltip and open file dialog</extracomment>
         <translation>Export transaction history</translation>
     </message>
+    <message id="wallet-export-tx-history-progress">
+        <source>Exporting transaction history</source>
+        <translation>Exporting transaction history</translation>
+    </message>
+    <message id="wallet-export-tx-history-csv">
+        <source>Export to CSV</source>
+        <extracomment>transaction history screen, export menu, zip archive of csv files</extracomment>
+        <translation>Export to CSV</translation>
+    </message>
+    <message id="wallet-export-tx-history-columns">
+        <source>Export to columnar file</source>
+        <extracomment>transaction history screen, export menu, memory mappable columnar file</extracomment>
+        <translation>Export to columnar file</translation>
+    </message>
+    <message id="wallet-export-tx-history-columns-dialog">
+        <source>Export transaction history to columnar file</source>
+        <extracomment>transaction history screen, open file dialog for the columnar export</extracomment>
+        <translation>Export transaction history to columnar file</translation>
+    </message>
+    <message id="wallet-txs-asset-stats">
+        <source>%1 transactions, sent %2, received %3, fees %4 %5, last activity %6</source>
+        <extracomment>transaction history screen, totals of the selected asset</extracomment>
+        <translation>%1 transactions, sent %2, received %3, fees %4 %5, last activity %6</translation>
+    </message>
+    <message id="wallet-txs-loading">
+        <source>Loading transactions</source>
+        <translation>Loading transactions</translation>
+    </message>
     <message id="addresses-delete-warning-title">
         <source>Delete address</source>
         <translation>Delete address</translation>
@@ -2508,6 +2536,26 @@ Update your settings and try again.</translation>
         <source>Maximum anonymity</source>
         <translation>Maximum anonymity</translation>
     </message>
+    <message id="balance-tx-count">
+        <source>Transactions</source>
+        <translation>Transactions</translation>
+    </message>
+    <message id="balance-last-activity">
+        <source>Last activity</source>
+        <translation>Last activity</translation>
+    </message>
+    <message id="balance-sent">
+        <source>Sent</source>
+        <translation>Sent</translation>
+    </message>
+    <message id="balance-received">
+        <source>Received</source>
+        <translation>Received</translation>
+    </message>
+    <message id="balance-fees-paid">
+        <source>Fees paid</source>
+        <translation>Fees paid</translation>
+    </message>
     <message id="info-asset-id">
         <source>Asset ID</source>
         <translation>Asset ID</translation>
@@ -2673,6 +2721,20 @@ Update your settings and try again.</translation>
         <extracomment>settings tab, general section, minimum confirmations</extracomment>
         <translation>Minimum confirmations</translation>
     </message>
+    <message id="settings-general-export-compression">
+        <source>Export compression level</source>
+        <extracomment>settings tab, general section, transaction history export compression level</extracomment>
+        <translation>Export compression level</translation>
+    </message>
+    <message id="settings-general-export-compression-default">
+        <source>Default</source>
+        <translation>Default</translation>
+    </message>
+    <message id="settings-general-export-parallel">
+        <source>Compress exported history in parallel</source>
+        <extracomment>settings tab, general section, compress transaction history export in parallel</extracomment>
+        <translation>Compress exported history in parallel</translation>
+    </message>
     <message id="tx-details-confirmation-status-label">
         <source>Confirmation status</source>
         <translation>Confirmation status</translation>
@@ -465,6 +465,14 @@ void AppModel::onResetWallet()
     assert(m_myAssets.use_count() == 1);
     m_myAssets.reset();
 
+    assert(m_assetStats);
+    assert(m_assetStats.use_count() == 1);
+    m_assetStats.reset();
+
+    assert(m_txStore);
+    assert(m_txStore.use_count() == 1);
+    m_txStore.reset();
+
     assert(m_assets);
     assert(m_assets.use_count() == 1);
     m_assets.reset();
@@ -680,7 +688,9 @@ void AppModel::start()
     m_wallet   = std::make_unique<WalletModel>(m_db, getNodeAddress(), m_walletReactor);
     m_rates    = std::make_shared<ExchangeRatesManager>(m_wallet.get(), m_settings);
     m_assets   = std::make_shared<AssetsManager>(m_wallet.get(), m_rates);
-    m_myAssets = std::make_shared<AssetsList>(m_wallet.get(), m_assets, m_rates);
+    m_txStore  = std::make_shared<TxStore>(m_wallet.get());
+    m_assetStats = std::make_shared<AssetStats>(m_txStore);
+    m_myAssets = std::make_shared<AssetsList>(m_wallet.get(), m_assets, m_rates, m_assetStats);
 
     if (m_settings.getRunLocalNode())
     {
@@ -741,6 +751,22 @@ AssetsList::Ptr AppModel::getMyAssets() const
     return m_myAssets;
 }
 
+TxStore::Ptr AppModel::getTxStore() const
+{
+    if (m_txStore) return m_txStore;
+
+    assert(false);
+    throw std::runtime_error("getTxStore for empty store");
+}
+
+AssetStats::Ptr AppModel::getAssetStats() const
+{
+    if (m_assetStats) return m_assetStats;
+
+    assert(false);
+    throw std::runtime_error("getAssetStats for empty stats");
+}
+
 WalletSettings& AppModel::getSettings() const
 {
     return m_settings;
@@ -27,6 +27,8 @@
 #include "assets_manager.h"
 #include "exchange_rates_manager.h"
 #include "assets_list.h"
+#include "asset_stats.h"
+#include "tx_store.h"
 #include <memory>
 #include <QSharedMemory>
 #include <QSystemSemaphore>
@@ -85,6 +87,8 @@ public:
     [[nodiscard]] AssetsManager::Ptr getAssets() const;
     [[nodiscard]] ExchangeRatesManager::Ptr getRates() const;
     [[nodiscard]] AssetsList::Ptr getMyAssets() const;
+    [[nodiscard]] AssetStats::Ptr getAssetStats() const;
+    [[nodiscard]] TxStore::Ptr getTxStore() const;
 
     MessageManager& getMessages();
 
@@ -137,6 +141,8 @@ private:
     WalletSettings& m_settings;
     ExchangeRatesManager::Ptr m_rates;
     AssetsManager::Ptr m_assets;
+    TxStore::Ptr m_txStore;
+    AssetStats::Ptr m_assetStats;
     AssetsList::Ptr m_myAssets; // assets in the wallet + BEAM even if 0
     MessageManager m_messages;
     ECC::NoLeak<ECC::uintBig> m_passwordHash;
@@ -0,0 +1,218 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "asset_stats.h"
+#include "bvm/ManagerStd.h"
+
+namespace
+{
+    void add(beam::AmountBig::Type& total, beam::Amount value)
+    {
+        total += beam::AmountBig::Type(value);
+    }
+
+    void subtract(beam::AmountBig::Type& total, beam::Amount value)
+    {
+        beam::AmountBig::Type negated(value);
+        negated.Negate();
+        total += negated;
+    }
+}
+
+AssetStats::AssetStats(TxStore::Ptr txStore)
+    : _txStore(std::move(txStore))
+{
+    connect(_txStore.get(), &TxStore::transactionsChanged, this, &AssetStats::onTransactionsChanged);
+    if (_txStore->isLoaded())
+    {
+        onTransactionsChanged(beam::wallet::ChangeAction::Reset, _txStore->getAll());
+    }
+}
+
+const AssetStats::Totals& AssetStats::get(beam::Asset::ID assetId) const
+{
+    static const Totals kEmpty;
+
+    auto it = _totals.find(assetId);
+    return it != _totals.end() ? it->second : kEmpty;
+}
+
+// mirrors the per-asset amounts TxObject shows in the transactions list
+AssetStats::TxEntry AssetStats::makeEntry(const beam::wallet::TxDescription& tx)
+{
+    using namespace beam;
+    using namespace beam::wallet;
+
+    TxEntry entry;
+    entry.time = tx.m_createTime;
+
+    const bool completed = tx.m_status == TxStatus::Completed;
+    auto appendPart = [&](Asset::ID assetId, Amount amount, bool income)
+    {
+        TxPart part;
+        part.assetId = assetId;
+        if (completed)
+        {
+            (income ? part.received : part.sent) = amount;
+        }
+        entry.parts.push_back(part);
+    };
+
+    Amount fee = tx.m_fee;
+    if (tx.m_txType == TxType::Contract)
+    {
+        bvm2::ContractInvokeData vData;
+        if (tx.GetParameter(TxParameterID::ContractDataPacked, vData))
+        {
+            fee = vData.get_FullFee(tx.m_minHeight);
+            const auto& spend = vData.m_SpendMax.empty() ? vData.get_FullSpend() : vData.m_SpendMax;
+            for (const auto& info: spend)
+            {
+                auto amount = info.second;
+                if (info.first == Asset::s_BeamID && amount < 0)
+                {
+                    amount += fee;
+                }
+                appendPart(info.first, std::abs(amount), amount <= 0);
+            }
+        }
+    }
+    else if (tx.m_txType == TxType::DexSimpleSwap)
+    {
+        const auto rasset  = tx.GetParameter<Asset::ID>(TxParameterID::DexReceiveAsset);
+        const auto ramount = tx.GetParameter<Amount>(TxParameterID::DexReceiveAmount);
+        if (rasset && ramount)
+        {
+            appendPart(*rasset, *ramount, true);
+        }
+        appendPart(tx.m_assetId, tx.m_amount, false);
+    }
+    else if (tx.m_selfTx)
+    {
+        appendPart(tx.m_assetId, 0, false);
+    }
+    else
+    {
+        appendPart(tx.m_assetId, tx.m_amount, !tx.m_sender);
+    }
+
+    // the receiver of a simple transaction does not pay the fee, a contract call may spend nothing but it
+    const bool paysFee = tx.m_sender || tx.m_txType == TxType::Contract || tx.m_txType == TxType::DexSimpleSwap;
+    if (entry.parts.empty())
+    {
+        appendPart(Asset::s_BeamID, 0, false);
+    }
+
+    if (completed && paysFee)
+    {
+        entry.parts.back().fee = fee;
+    }
+
+    return entry;
+}
+
+void AssetStats::addTx(const TxEntry& entry)
+{
+    for (const auto& part: entry.parts)
+    {
+        auto& totals = _totals[part.assetId];
+        add(totals.sent, part.sent);
+        add(totals.received, part.received);
+        add(totals.fee, part.fee);
+        ++totals.txCount;
+        totals.lastActivity = std::max(totals.lastActivity, entry.time);
+        _changed.insert(part.assetId);
+    }
+}
+
+void AssetStats::removeTx(const TxEntry& entry)
+{
+    for (const auto& part: entry.parts)
+    {
+        auto& totals = _totals[part.assetId];
+        subtract(totals.sent, part.sent);
+        subtract(totals.received, part.received);
+        subtract(totals.fee, part.fee);
+        --totals.txCount;
+        if (totals.lastActivity == entry.time)
+        {
+            recalcLastActivity(part.assetId);
+        }
+        _changed.insert(part.assetId);
+    }
+}
+
+// the latest transaction of an asset is rarely deleted, a rescan is cheaper than keeping every timestamp sorted
+void AssetStats::recalcLastActivity(beam::Asset::ID assetId)
+{
+    beam::Timestamp last = 0;
+    for (const auto& [txId, entry]: _txs)
+    {
+        for (const auto& part: entry.parts)
+        {
+            if (part.assetId == assetId)
+            {
+                last = std::max(last, entry.time);
+            }
+        }
+    }
+    _totals[assetId].lastActivity = last;
+}
+
+void AssetStats::notifyChanged()
+{
+    auto changed = std::move(_changed);
+    _changed.clear();
+
+    for (auto assetId: changed)
+    {
+        emit statsChanged(assetId);
+    }
+}
+
+void AssetStats::onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items)
+{
+    using namespace beam::wallet;
+
+    if (action == ChangeAction::Reset)
+    {
+        for (auto& [assetId, totals]: _totals)
+        {
+            totals.sent = beam::Zero;
+            totals.received = beam::Zero;
+            totals.fee = beam::Zero;
+            totals.txCount = 0;
+            totals.lastActivity = 0;
+            _changed.insert(assetId);
+        }
+        _txs.clear();
+    }
+
+    for (const auto& tx: items)
+    {
+        if (auto it = _txs.find(tx.m_txId); it != _txs.end())
+        {
+            removeTx(it->second);
+            _txs.erase(it);
+        }
+
+        if (action != ChangeAction::Removed)
+        {
+            auto entry = makeEntry(tx);
+            addTx(entry);
+            _txs.emplace(tx.m_txId, std::move(entry));
+        }
+    }
+
+    notifyChanged();
+}
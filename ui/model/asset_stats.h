@@ -0,0 +1,78 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QObject>
+#include <set>
+#include <unordered_map>
+#include "tx_store.h"
+#include "viewmodel/helpers/keyed_list_model.h"
+
+// Per-asset transaction totals kept up to date from the TxStore deltas,
+// so views read them with a single lookup instead of walking the history.
+// Balances stay on WalletModel, its cached wallet status already has them.
+class AssetStats : public QObject
+{
+    Q_OBJECT
+public:
+    typedef std::shared_ptr<AssetStats> Ptr;
+
+    struct Totals
+    {
+        beam::AmountBig::Type sent = beam::Zero;        // completed transactions only
+        beam::AmountBig::Type received = beam::Zero;
+        beam::AmountBig::Type fee = beam::Zero;         // in BEAM, paid by the transactions of the asset
+        uint32_t txCount = 0;                           // transactions of any status
+        beam::Timestamp lastActivity = 0;
+    };
+
+    explicit AssetStats(TxStore::Ptr txStore);
+    ~AssetStats() override = default;
+
+    [[nodiscard]] const Totals& get(beam::Asset::ID assetId) const;
+
+signals:
+    void statsChanged(beam::Asset::ID assetId);
+
+private slots:
+    void onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items);
+
+private:
+    // what a single transaction adds to one asset
+    struct TxPart
+    {
+        beam::Asset::ID assetId = beam::Asset::s_BeamID;
+        beam::Amount sent = 0;
+        beam::Amount received = 0;
+        beam::Amount fee = 0;
+    };
+
+    struct TxEntry
+    {
+        std::vector<TxPart> parts;
+        beam::Timestamp time = 0;
+    };
+
+    static TxEntry makeEntry(const beam::wallet::TxDescription& tx);
+
+    void addTx(const TxEntry& entry);
+    void removeTx(const TxEntry& entry);
+    void recalcLastActivity(beam::Asset::ID assetId);
+    void notifyChanged();
+
+    TxStore::Ptr _txStore;
+    std::unordered_map<beam::Asset::ID, Totals> _totals;
+    std::unordered_map<beam::wallet::TxID, TxEntry, ListModelKeyHash> _txs;
+    std::set<beam::Asset::ID> _changed;
+};
@@ -10,20 +10,20 @@
 // limitations under the License.
 #include "assets_list.h"
 #include "viewmodel/ui_helpers.h"
+#include <QDateTime>
 
-AssetsList::AssetsList(WalletModel::Ptr wallet, AssetsManager::Ptr assets, ExchangeRatesManager::Ptr rates)
+AssetsList::AssetsList(WalletModel::Ptr wallet, AssetsManager::Ptr assets, ExchangeRatesManager::Ptr rates, AssetStats::Ptr stats)
     : _wallet(std::move(wallet))
     , _amgr(std::move(assets))
     , _rates(std::move(rates))
+    , _stats(std::move(stats))
 {
     connect(_rates.get(),  &ExchangeRatesManager::rateUnitChanged, this,  &AssetsList::onNewRates);
     connect(_rates.get(),  &ExchangeRatesManager::activeRateChanged, this,  &AssetsList::onNewRates);
     connect(_wallet, &WalletModel::walletStatusChanged, this, &AssetsList::onWalletStatus);
     connect(_amgr.get(),   &AssetsManager::assetInfo, this,  &AssetsList::onAssetInfo);
+    connect(_stats.get(),  &AssetStats::statsChanged, this,  &AssetsList::onAssetInfo);
     _wallet->getAsync()->getWalletStatus();
-    // Transactions table would be created later and get this for us
-    // Need to refactor multiple requests in the future
-    //_wallet.getAsync()->getTransactions();
 }
 
 QHash<int, QByteArray> AssetsList::roleNames() const
@@ -53,6 +53,11 @@ QHash<int, QByteArray> AssetsList::roleNames() const
         {static_cast<int>(Roles::RSiteUrl),         "siteUrl"},
         {static_cast<int>(Roles::RWhitePaper),      "whitePaper"},
         {static_cast<int>(Roles::RVerified),        "verified"},
+        {static_cast<int>(Roles::RSent),            "sent"},
+        {static_cast<int>(Roles::RReceived),        "received"},
+        {static_cast<int>(Roles::RFee),             "fee"},
+        {static_cast<int>(Roles::RTxCount),         "txCount"},
+        {static_cast<int>(Roles::RLastActivity),    "lastActivity"},
     };
     return roles;
 }
@@ -139,6 +144,19 @@ QVariant AssetsList::data(const QModelIndex &index, int role) const
             return _amgr->getPaperUrl(assetId);
         case Roles::RVerified:
             return _amgr->isVerified(assetId);
+        case Roles::RSent:
+            return beamui::AmountBigToUIString(_stats->get(assetId).sent);
+        case Roles::RReceived:
+            return beamui::AmountBigToUIString(_stats->get(assetId).received);
+        case Roles::RFee:
+            return beamui::AmountBigToUIString(_stats->get(assetId).fee);
+        case Roles::RTxCount:
+            return _stats->get(assetId).txCount;
+        case Roles::RLastActivity:
+        {
+            const auto time = _stats->get(assetId).lastActivity;
+            return time ? QDateTime::fromSecsSinceEpoch(time) : QDateTime();
+        }
         case Roles::RRate:
             {
                 auto rate = _rates->getRate(beam::wallet::Currency(assetId));
@@ -16,6 +16,7 @@
 #include "assets_manager.h"
 #include "wallet_model.h"
 #include "exchange_rates_manager.h"
+#include "asset_stats.h"
 
 class AssetsList: public ListModel<std::shared_ptr<AssetObject>>
 {
@@ -23,7 +24,7 @@ class AssetsList: public ListModel<std::shared_ptr<AssetObject>>
 public:
     typedef std::shared_ptr<AssetsList> Ptr;
 
-    AssetsList(WalletModel::Ptr wallet, AssetsManager::Ptr assets, ExchangeRatesManager::Ptr rates);
+    AssetsList(WalletModel::Ptr wallet, AssetsManager::Ptr assets, ExchangeRatesManager::Ptr rates, AssetStats::Ptr stats);
     ~AssetsList() override = default;
 
     enum class Roles
@@ -51,6 +52,11 @@ public:
         RSiteUrl,
         RWhitePaper,
         RVerified,
+        RSent,
+        RReceived,
+        RFee,
+        RTxCount,
+        RLastActivity,
     };
 
     Q_ENUM(Roles)
@@ -72,4 +78,5 @@ private:
     WalletModel::Ptr _wallet;
     AssetsManager::Ptr _amgr;
     ExchangeRatesManager::Ptr _rates;
+    AssetStats::Ptr _stats;
 };
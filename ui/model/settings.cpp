@@ -112,6 +112,9 @@ namespace
     const char* kTxFilterCanceled= "tx_filter/canceled";
     const char* kTxFilterFailed = "tx_filter/failed";
 
+    const char* kTxExportParallel = "tx_export/parallel";
+    const char* kTxExportCompressionLevel = "tx_export/compression_level";
+
     const std::vector<std::string> kOutDatedPeers = beam::getOutdatedDefaultPeers();
     bool isOutDatedPeer(const std::string& peer)
     {
@@ -1228,6 +1231,31 @@ void WalletSettings::setShowFailed(bool value)
     m_accountSettings.m_data.setValue(kTxFilterFailed, value);
 }
 
+bool WalletSettings::getTxExportParallel() const
+{
+    Lock lock(m_mutex);
+    return m_accountSettings.m_data.value(kTxExportParallel, false).toBool();
+}
+
+void WalletSettings::setTxExportParallel(bool value)
+{
+    Lock lock(m_mutex);
+    m_accountSettings.m_data.setValue(kTxExportParallel, value);
+}
+
+int WalletSettings::getTxExportCompressionLevel() const
+{
+    Lock lock(m_mutex);
+    // -1 is the zlib default
+    return m_accountSettings.m_data.value(kTxExportCompressionLevel, -1).toInt();
+}
+
+void WalletSettings::setTxExportCompressionLevel(int value)
+{
+    Lock lock(m_mutex);
+    m_accountSettings.m_data.setValue(kTxExportCompressionLevel, value);
+}
+
 bool WalletSettings::isAppActive() const
 {
     Lock lock(m_mutex);
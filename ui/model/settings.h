@@ -167,6 +167,12 @@ public:
     bool getShowFailed() const;
     void setShowFailed(bool value);
 
+    // tx history export
+    bool getTxExportParallel() const;
+    void setTxExportParallel(bool value);
+    int getTxExportCompressionLevel() const;
+    void setTxExportCompressionLevel(int value);
+
     bool isAppActive() const;
     void setAppActive(bool value);
     QString getAccountLabel() const;
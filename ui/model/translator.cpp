@@ -13,6 +13,7 @@
 // limitations under the License.
 #include "translator.h"
 #include <QApplication>
+#include "viewmodel/wallet/tx_status.h"
 
 namespace
 {
@@ -48,5 +49,6 @@ void Translator::onLocaleChanged()
 {
     qApp->removeTranslator(&_translator);
     loadTranslation();
+    beamui::retranslateTxUIStatuses();
     _engine.retranslate();
 }
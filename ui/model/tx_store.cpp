@@ -0,0 +1,138 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "tx_store.h"
+
+TxStore::TxStore(WalletModel::Ptr wallet)
+    : _wallet(wallet)
+{
+    connect(_wallet, &WalletModel::transactionsChanged, this, &TxStore::onTransactionsChanged);
+    _wallet->getAsync()->getTransactions();
+}
+
+bool TxStore::isLoaded() const
+{
+    return _loaded;
+}
+
+size_t TxStore::size() const
+{
+    return _txs.size();
+}
+
+bool TxStore::contains(const beam::wallet::TxID& txId) const
+{
+    return _txs.find(txId) != _txs.end();
+}
+
+const beam::wallet::TxDescription* TxStore::find(const beam::wallet::TxID& txId) const
+{
+    auto it = _txs.find(txId);
+    return it != _txs.end() ? &it->second : nullptr;
+}
+
+std::vector<beam::wallet::TxDescription> TxStore::getAll() const
+{
+    std::vector<beam::wallet::TxDescription> result;
+    result.reserve(_txs.size());
+    for (const auto& [txId, tx]: _txs)
+    {
+        result.push_back(tx);
+    }
+    return result;
+}
+
+std::vector<beam::wallet::TxDescription> TxStore::getByPeer(const beam::wallet::WalletID& peer) const
+{
+    auto it = _byPeer.find(peer);
+    return it != _byPeer.end() ? collect(it->second) : std::vector<beam::wallet::TxDescription>();
+}
+
+std::vector<beam::wallet::TxDescription> TxStore::getByType(beam::wallet::TxType type) const
+{
+    auto it = _byType.find(type);
+    return it != _byType.end() ? collect(it->second) : std::vector<beam::wallet::TxDescription>();
+}
+
+std::vector<beam::wallet::TxDescription> TxStore::collect(const TxIDSet& ids) const
+{
+    std::vector<beam::wallet::TxDescription> result;
+    result.reserve(ids.size());
+    for (const auto& txId: ids)
+    {
+        result.push_back(_txs.at(txId));
+    }
+    return result;
+}
+
+void TxStore::add(const beam::wallet::TxDescription& tx)
+{
+    _txs[tx.m_txId] = tx;
+    _byPeer[tx.m_peerAddr].insert(tx.m_txId);
+    _byType[tx.m_txType].insert(tx.m_txId);
+}
+
+// indexes are cleaned by the stored copy, the peer of a transaction may be set by an update
+void TxStore::remove(const beam::wallet::TxID& txId)
+{
+    auto it = _txs.find(txId);
+    if (it == _txs.end())
+    {
+        return;
+    }
+
+    auto eraseFrom = [&txId](auto& index, const auto& key)
+    {
+        if (auto ids = index.find(key); ids != index.end())
+        {
+            ids->second.erase(txId);
+            if (ids->second.empty())
+            {
+                index.erase(ids);
+            }
+        }
+    };
+
+    eraseFrom(_byPeer, it->second.m_peerAddr);
+    eraseFrom(_byType, it->second.m_txType);
+    _txs.erase(it);
+}
+
+void TxStore::onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items)
+{
+    using namespace beam::wallet;
+
+    if (action == ChangeAction::Reset)
+    {
+        _txs.clear();
+        _byPeer.clear();
+        _byType.clear();
+    }
+
+    for (const auto& tx: items)
+    {
+        remove(tx.m_txId);
+        if (action != ChangeAction::Removed)
+        {
+            add(tx);
+        }
+    }
+
+    emit transactionsChanged(action, items);
+
+    if (action == ChangeAction::Reset && !_loaded)
+    {
+        _loaded = true;
+        emit loaded();
+    }
+}
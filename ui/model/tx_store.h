@@ -0,0 +1,68 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QObject>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include "wallet_model.h"
+#include "viewmodel/helpers/keyed_list_model.h"
+
+// The transaction history shared by all the views. It is loaded once from the wallet
+// and then kept up to date by the transactionsChanged deltas, views read it through
+// the indexes below and subscribe to its own transactionsChanged instead of asking
+// the wallet for the whole history again.
+class TxStore : public QObject
+{
+    Q_OBJECT
+public:
+    typedef std::shared_ptr<TxStore> Ptr;
+
+    explicit TxStore(WalletModel::Ptr wallet);
+    ~TxStore() override = default;
+
+    // false until the first full history arrives
+    [[nodiscard]] bool isLoaded() const;
+    [[nodiscard]] size_t size() const;
+
+    [[nodiscard]] bool contains(const beam::wallet::TxID& txId) const;
+    [[nodiscard]] const beam::wallet::TxDescription* find(const beam::wallet::TxID& txId) const;
+
+    [[nodiscard]] std::vector<beam::wallet::TxDescription> getAll() const;
+    [[nodiscard]] std::vector<beam::wallet::TxDescription> getByPeer(const beam::wallet::WalletID& peer) const;
+    [[nodiscard]] std::vector<beam::wallet::TxDescription> getByType(beam::wallet::TxType type) const;
+
+signals:
+    void loaded();
+    // emitted after the store and its indexes are updated, Reset carries the whole history
+    void transactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items);
+
+private slots:
+    void onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items);
+
+private:
+    using TxIDSet = std::unordered_set<beam::wallet::TxID, ListModelKeyHash>;
+
+    void add(const beam::wallet::TxDescription& tx);
+    void remove(const beam::wallet::TxID& txId);
+    std::vector<beam::wallet::TxDescription> collect(const TxIDSet& ids) const;
+
+    WalletModel::Ptr _wallet;
+    bool _loaded = false;
+
+    std::unordered_map<beam::wallet::TxID, beam::wallet::TxDescription, ListModelKeyHash> _txs;
+    std::map<beam::wallet::WalletID, TxIDSet> _byPeer;
+    std::map<beam::wallet::TxType, TxIDSet> _byType;
+};
@@ -269,26 +269,26 @@ void WalletModel::onExportDataToJson(const std::string& data)
 
 void WalletModel::onExportTxHistoryToCsv(const std::string& data)
 {
-    emit txHistoryExportedToCsv(QString::fromStdString(data));
+    emit txHistoryExportedToCsv(QByteArray::fromStdString(data));
 }
 
 #ifdef BEAM_ATOMIC_SWAP_SUPPORT
 void WalletModel::onExportAtomicSwapTxHistoryToCsv(const std::string& data)
 {
-    emit atomicSwapTxHistoryExportedToCsv(QString::fromStdString(data));
+    emit atomicSwapTxHistoryExportedToCsv(QByteArray::fromStdString(data));
 }
 #endif // BEAM_ATOMIC_SWAP_SUPPORT
 
 #ifdef BEAM_ASSET_SWAP_SUPPORT
 void WalletModel::onExportAssetsSwapTxHistoryToCsv(const std::string& data)
 {
-    emit assetsSwapTxHistoryExportedToCsv(QString::fromStdString(data));
+    emit assetsSwapTxHistoryExportedToCsv(QByteArray::fromStdString(data));
 }
 #endif  // BEAM_ASSET_SWAP_SUPPORT
 
 void WalletModel::onExportContractTxHistoryToCsv(const std::string& data)
 {
-    emit contractTxHistoryExportedToCsv(QString::fromStdString(data));
+    emit contractTxHistoryExportedToCsv(QByteArray::fromStdString(data));
 }
 
 void WalletModel::onNodeConnectionChanged(bool isNodeConnected)
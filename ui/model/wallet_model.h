@@ -87,14 +87,14 @@ signals:
     void paymentProofExported(const beam::wallet::TxID& txID, const QString& proof);
     void addressChecked(const QString& addr, bool isValid);
     void functionPosted(const std::function<void()>&);
-    void txHistoryExportedToCsv(const QString& data);
+    void txHistoryExportedToCsv(const QByteArray& data);
 #ifdef BEAM_ATOMIC_SWAP_SUPPORT
-    void atomicSwapTxHistoryExportedToCsv(const QString& data);
+    void atomicSwapTxHistoryExportedToCsv(const QByteArray& data);
 #endif // BEAM_ATOMIC_SWAP_SUPPORT
 #ifdef BEAM_ASSET_SWAP_SUPPORT
-    void assetsSwapTxHistoryExportedToCsv(const QString& data);
+    void assetsSwapTxHistoryExportedToCsv(const QByteArray& data);
 #endif  // BEAM_ASSET_SWAP_SUPPORT
-    void contractTxHistoryExportedToCsv(const QString& data);
+    void contractTxHistoryExportedToCsv(const QByteArray& data);
 
     void fullAssetsListLoaded();
     void instantMessage(beam::Timestamp time, const beam::wallet::WalletID& counterpart, const std::string& message, bool isIncome);
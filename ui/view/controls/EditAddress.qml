@@ -104,7 +104,7 @@ CustomDialog {
 
                 //% "Expire now"
                 text: qsTrId("edit-addr-expire-now")
-                enabled: !viewModel.isWIDBusy(control.walletID)
+                enabled: !control.addressItem.busy
 
                 onClicked: {
                     var newExpiration = new Date(Date.now() - 1000)
@@ -138,7 +138,7 @@ CustomDialog {
             Layout.topMargin: 7
             font.pixelSize:   13
             font.italic:      true
-            visible:          viewModel.isWIDBusy(control.walletID)
+            visible:          control.addressItem.busy
         }
 
         SFText {
@@ -106,6 +106,49 @@ SettingsFoldable {
             }
         }
 
+        RowLayout {
+            SFText {
+                Layout.fillWidth: true
+                //: settings tab, general section, transaction history export compression level
+                //% "Export compression level"
+                text: qsTrId("settings-general-export-compression")
+                color: Style.content_secondary
+                font.pixelSize: 14
+            }
+            Item {}
+            CustomComboBox {
+                id: exportCompressionControl
+                fontPixelSize: 14
+                Layout.preferredWidth: secondCurrencySwitch.width
+                // first entry is the zlib default (-1), the rest are levels 0..9
+                currentIndex: viewModel.txExportCompressionLevel + 1
+                model: [
+                    //% "Default"
+                    qsTrId("settings-general-export-compression-default"),
+                    0, 1, 2, 3, 4, 5, 6, 7, 8, 9
+                ]
+                onActivated: {
+                    viewModel.txExportCompressionLevel = exportCompressionControl.currentIndex - 1
+                }
+            }
+        }
+
+        CustomSwitch {
+            id: exportParallelSwitch
+            //: settings tab, general section, compress transaction history export in parallel
+            //% "Compress exported history in parallel"
+            text: qsTrId("settings-general-export-parallel")
+            checked: viewModel.txExportParallel
+            Layout.fillWidth: true
+            font.styleName:   "Regular"
+            font.weight:      Font.Normal
+            Binding {
+                target: viewModel
+                property: "txExportParallel"
+                value: exportParallelSwitch.checked
+            }
+        }
+
         RowLayout {
             SFText {
                 Layout.fillWidth: true
@@ -52,6 +52,7 @@ CustomDialog {
             model: SortFilterProxyModel {
                 sortOrder: tableView.sortIndicatorOrder
                 sortCaseSensitivity: Qt.CaseInsensitive
+                typedSort: true
                 sortRole: tableView.getColumn(tableView.sortIndicatorColumn).role + "Sort"
                 source: viewModel.allUtxos
                 filterSyntax: SortFilterProxyModel.Wildcard
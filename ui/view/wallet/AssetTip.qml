@@ -364,6 +364,159 @@ AlphaTipPopup {
                         }
                     }
                 }
+
+                Rectangle {
+                    Layout.fillWidth:  true
+                    Layout.columnSpan: 2
+
+                    height:   1
+                    color:    "white"
+                    opacity:  0.1
+                    visible:  txCountCtrl.visible
+                    Layout.rightMargin: 14
+                }
+
+                SFText {
+                    //% "Transactions"
+                    text:    qsTrId("balance-tx-count")
+                    color:   assetTip.defTextColor
+                    visible: txCountCtrl.visible
+
+                    font {
+                        pixelSize: 13
+                        styleName: "Light"
+                        weight:    Font.Light
+                    }
+                }
+
+                SFText {
+                    id:      txCountCtrl
+                    text:    assetInfo.txCount
+                    color:   assetTip.defTextColor
+                    visible: assetInfo.txCount > 0
+                    Layout.rightMargin: 14
+
+                    font {
+                        pixelSize: 13
+                        styleName: "Normal"
+                        weight:    Font.Normal
+                    }
+                }
+
+                SFText {
+                    //% "Last activity"
+                    text:    qsTrId("balance-last-activity")
+                    color:   assetTip.defTextColor
+                    visible: txCountCtrl.visible
+
+                    font {
+                        pixelSize: 13
+                        styleName: "Light"
+                        weight:    Font.Light
+                    }
+                }
+
+                SFText {
+                    text:    txCountCtrl.visible ? Utils.formatDateTime(assetInfo.lastActivity, BeamGlobals.getLocaleName()) : ""
+                    color:   assetTip.defTextColor
+                    visible: txCountCtrl.visible
+                    Layout.rightMargin: 14
+
+                    font {
+                        pixelSize: 13
+                        styleName: "Normal"
+                        weight:    Font.Normal
+                    }
+                }
+
+                SFText {
+                    //% "Sent"
+                    text:    qsTrId("balance-sent")
+                    color:   assetTip.defTextColor
+                    visible: sentCtrl.visible
+
+                    font {
+                        pixelSize: 13
+                        styleName: "Light"
+                        weight:    Font.Light
+                    }
+                }
+
+                BeamAmount {
+                    id:           sentCtrl
+                    unitName:     assetInfo.unitName
+                    rateUnit:     assetInfo.rateUnit
+                    rate:         assetInfo.rate
+                    color:        assetTip.defTextColor
+                    amount:       assetInfo.sent
+                    visible:      txCountCtrl.visible && amount != "0"
+
+                    font.styleName:  "Normal"
+                    font.weight:     Font.Normal
+                    font.pixelSize:  13
+                    maxPaintedWidth: false
+                    maxUnitChars:    20
+                    Layout.rightMargin: 14
+                }
+
+                SFText {
+                    //% "Received"
+                    text:    qsTrId("balance-received")
+                    color:   assetTip.defTextColor
+                    visible: receivedCtrl.visible
+
+                    font {
+                        pixelSize: 13
+                        styleName: "Light"
+                        weight:    Font.Light
+                    }
+                }
+
+                BeamAmount {
+                    id:           receivedCtrl
+                    unitName:     assetInfo.unitName
+                    rateUnit:     assetInfo.rateUnit
+                    rate:         assetInfo.rate
+                    color:        assetTip.defTextColor
+                    amount:       assetInfo.received
+                    visible:      txCountCtrl.visible && amount != "0"
+
+                    font.styleName:  "Normal"
+                    font.weight:     Font.Normal
+                    font.pixelSize:  13
+                    maxPaintedWidth: false
+                    maxUnitChars:    20
+                    Layout.rightMargin: 14
+                }
+
+                SFText {
+                    //% "Fees paid"
+                    text:    qsTrId("balance-fees-paid")
+                    color:   assetTip.defTextColor
+                    visible: feeCtrl.visible
+
+                    font {
+                        pixelSize: 13
+                        styleName: "Light"
+                        weight:    Font.Light
+                    }
+                }
+
+                BeamAmount {
+                    id:           feeCtrl
+                    // fees are always paid in BEAM
+                    unitName:     BeamGlobals.beamUnit
+                    color:        assetTip.defTextColor
+                    amount:       assetInfo.fee
+                    visible:      txCountCtrl.visible && amount != "0"
+
+                    font.styleName:  "Normal"
+                    font.weight:     Font.Normal
+                    font.pixelSize:  13
+                    maxPaintedWidth: false
+                    maxUnitChars:    20
+                    Layout.rightMargin: 14
+                }
             }
         }
 
@@ -14,11 +14,27 @@ Control {
 
     TxTableViewModel {
         id: tableViewModel
+        assetFilter:  control.selectedAssets
+        dexFilter:    control.dexFilter
+        dappFilter:   control.dappFilter ? control.dappFilter : ""
+        searchFilter: searchBox.text
+    }
+
+    Binding {
+        target:   tableViewModel.pagedTransactions
+        property: "sortRole"
+        value:    transactionsTable.getColumn(transactionsTable.sortIndicatorColumn).role + "Sort"
+    }
+
+    Binding {
+        target:   tableViewModel.pagedTransactions
+        property: "sortOrder"
+        value:    transactionsTable.sortIndicatorOrder
     }
 
     property var       selectedAssets: []
     property int       emptyMessageMargin: 90
-    property int       activeTxCnt: 0
+    readonly property int activeTxCnt: tableViewModel.pagedTransactions.activeCount
     property alias     headerShaderVisible: transactionsTable.headerShaderVisible
     property alias     mainBackgroundRect: transactionsTable.mainBackgroundRect
     property bool      dexFilter: false
@@ -27,24 +43,6 @@ Control {
     readonly property  bool actionVisible: dappFilter !== undefined && dappFilter != "all"
     property var       owner
 
-    function getStatusFilter (){
-        let f = ["none"];
-        if (tableViewModel.showInProgress) {
-            f.push("inProgress");
-        }
-        if (tableViewModel.showCompleted) {
-            f.push("completed");
-        }
-        if (tableViewModel.showCanceled) {
-            f.push("canceled");
-        }
-        if (tableViewModel.showFailed) {
-            f.push("failed");
-        }
-        return f.join('|')
-    }
-    property var       selectedFilters: getStatusFilter()
-
     function showTxDetails(txid) {
         transactionsTable.showDetails(txid)
     }
@@ -66,8 +64,7 @@ Control {
         State {
             name: "inProgress"
             PropertyChanges { target: inProgressTab; state: "active" }
-            PropertyChanges { target: txProxyModel; filterRole: "isInProgress" }
-            PropertyChanges { target: txProxyModel; filterString: "true" }
+            PropertyChanges { target: tableViewModel.pagedTransactions; filterRole: "isInProgress" }
             PropertyChanges { target: emptyMessage;  
                 //% "There are no in progress transactions yet."
                 text: qsTrId("tx-in-progress-empty")
@@ -76,8 +73,7 @@ Control {
         State {
             name: "sent"
             PropertyChanges { target: sentTab; state: "active" }
-            PropertyChanges { target: txProxyModel; filterRole: "isSent" }
-            PropertyChanges { target: txProxyModel; filterString: "true" }
+            PropertyChanges { target: tableViewModel.pagedTransactions; filterRole: "isSent" }
             PropertyChanges { target: emptyMessage;  
                 //% "There are no sent transactions yet."
                 text: qsTrId("tx-sent-empty")
@@ -86,8 +82,7 @@ Control {
         State {
             name: "received"
             PropertyChanges { target: receivedTab; state: "active" }
-            PropertyChanges { target: txProxyModel; filterRole: "isReceived" }
-            PropertyChanges { target: txProxyModel; filterString: "true" }
+            PropertyChanges { target: tableViewModel.pagedTransactions; filterRole: "isReceived" }
             PropertyChanges { target: emptyMessage;  
                 //% "There are no received transactions yet."
                 text: qsTrId("tx-received-empty")
@@ -239,7 +234,33 @@ Control {
                 ToolTip.timeout: 2000
                 hoverEnabled: true
                 onClicked: {
-                    tableViewModel.exportTxHistoryToCsv();
+                    exportMenu.popup();
+                }
+
+                ContextMenu {
+                    id: exportMenu
+                    modal: true
+                    dim: false
+
+                    Action {
+                        //: transaction history screen, export menu, zip archive of csv files
+                        //% "Export to CSV"
+                        text: qsTrId("wallet-export-tx-history-csv")
+                        icon.source: "qrc:/assets/icon-export.svg"
+                        onTriggered: {
+                            tableViewModel.exportTxHistoryToCsv();
+                        }
+                    }
+
+                    Action {
+                        //: transaction history screen, export menu, memory mappable columnar file
+                        //% "Export to columnar file"
+                        text: qsTrId("wallet-export-tx-history-columns")
+                        icon.source: "qrc:/assets/icon-export.svg"
+                        onTriggered: {
+                            tableViewModel.exportTxHistoryToColumns();
+                        }
+                    }
                 }
             }
 
@@ -260,10 +281,75 @@ Control {
             }
         }
 
+        RowLayout {
+            Layout.fillWidth:    true
+            Layout.bottomMargin: 10
+            spacing:             20
+            visible:             tableViewModel.loading
+
+            SFText {
+                //% "Loading transactions"
+                text:           qsTrId("wallet-txs-loading")
+                color:          Style.content_secondary
+                font.pixelSize: 12
+            }
+
+            CustomProgressBar {
+                Layout.fillWidth: true
+                value:            tableViewModel.loadingProgress
+            }
+        }
+
+        SFText {
+            Layout.fillWidth:    true
+            Layout.bottomMargin: 10
+            visible:             tableViewModel.hasAssetStats && tableViewModel.assetTxCount > 0 && !tableViewModel.loading
+            color:               Style.content_secondary
+            font.pixelSize:      12
+            elide:               Text.ElideRight
+            //: transaction history screen, totals of the selected asset
+            //% "%1 transactions, sent %2, received %3, fees %4 %5, last activity %6"
+            text: visible ? qsTrId("wallet-txs-asset-stats")
+                .arg(tableViewModel.assetTxCount)
+                .arg(tableViewModel.assetSent)
+                .arg(tableViewModel.assetReceived)
+                .arg(tableViewModel.assetFee)
+                .arg(BeamGlobals.beamUnit)
+                .arg(Utils.formatDateTime(tableViewModel.assetLastActivity, BeamGlobals.getLocaleName())) : ""
+        }
+
+        RowLayout {
+            Layout.fillWidth:    true
+            Layout.bottomMargin: 10
+            spacing:             20
+            visible:             tableViewModel.exporting
+
+            SFText {
+                //% "Exporting transaction history"
+                text:           qsTrId("wallet-export-tx-history-progress")
+                color:          Style.content_secondary
+                font.pixelSize: 12
+            }
+
+            CustomProgressBar {
+                Layout.fillWidth: true
+                value:            tableViewModel.exportProgress
+            }
+
+            LinkButton {
+                fontSize: 12
+                //% "Cancel"
+                text:     qsTrId("general-cancel")
+                onClicked: {
+                    tableViewModel.cancelExport();
+                }
+            }
+        }
+
         ColumnLayout {
             Layout.topMargin: emptyMessageMargin
             Layout.alignment: Qt.AlignHCenter
-            visible: transactionsTable.model.count == 0
+            visible: transactionsTable.model.count == 0 && !tableViewModel.loading
 
             SvgImage {
                 Layout.alignment: Qt.AlignHCenter
@@ -356,33 +442,21 @@ Control {
 
                 if (!id.length) return;
 
-                var index = tableViewModel.transactions.index(0, 0);
-                var indexList = tableViewModel.transactions.match(index, TxObjectList.Roles.TxID, id);
-                if (indexList.length > 0) {
-                    index = dexFilterProxy.mapFromSource(indexList[0]);
-                    index = dappFilterProxy.mapFromSource(index);
-                    index = assetFilterProxy.mapFromSource(index);
-                    index = searchProxyModel.mapFromSource(index);
-                    index = statusProxy.mapFromSource(index);
-                    index = txProxyModel.mapFromSource(index);
-                    transactionsTable.positionViewAtRow(index.row, ListView.Beginning);
-
-                    initTxDetailsFromRow(transactionsTable.model, index.row);
+                // the row is found and loaded by the model, txLocated opens it
+                transactionsTable.model.locate(id);
+            }
+
+            Connections {
+                target: tableViewModel.pagedTransactions
+                function onTxLocated(row) {
+                    transactionsTable.positionViewAtRow(row, ListView.Beginning);
+
+                    transactionsTable.initTxDetailsFromRow(transactionsTable.model, row);
                     txDetails.open();
                 }
             }
 
             Component.onCompleted: function () {
-                txProxyModel.source.countChanged.connect(function() {
-                    control.activeTxCnt = 0
-                    var source = txProxyModel.source
-                    for (var idx = 0; idx < source.count; ++idx) {
-                        var qindex = source.index(idx, 0);
-                        if (source.data(qindex, TxObjectList.Roles.IsActive)) {
-                            ++control.activeTxCnt
-                        }
-                    }
-                })
                 transactionsTable.model.modelReset.connect(function() {
                     var activeTxId = "";
                     if (owner && owner != undefined && owner.openedTxID != undefined && owner.openedTxID != "") {
@@ -414,58 +488,13 @@ Control {
                     : Qt.DescendingOrder;
             }
 
-            model: SortFilterProxyModel {
-                id: txProxyModel
-
-                source: SortFilterProxyModel {
-                    id: statusProxy
-                    filterRole: "filterStatus"
-                    filterString: control.selectedFilters
-                    filterSyntax: SortFilterProxyModel.RegExp
-
-                    source: SortFilterProxyModel {
-                        id: searchProxyModel
-                        filterRole: "search"
-                        filterString: searchBox.text
-                        filterSyntax: SortFilterProxyModel.Wildcard
-                        filterCaseSensitivity: Qt.CaseInsensitive
-
-                        source: SortFilterProxyModel {
-                            id:           assetFilterProxy
-                            filterRole:   "assetFilter"
-                            filterString: control.selectedAssets.reduce(function(sum, current) { return sum + ["|", "\\b", current, "\\b"].join(""); }, "").slice(1)
-                            filterSyntax: SortFilterProxyModel.RegExp
-
-                            source: SortFilterProxyModel {
-                                id:           dappFilterProxy
-                                filterRole:   dappFilter ? (dappFilter == "all" ? "isDappTx" : "dappId") : ""
-                                filterString: dappFilter ? (dappFilter == "all" ? "true" : dappFilter) : ""
-                                filterSyntax: SortFilterProxyModel.FixedString
-                                filterCaseSensitivity: Qt.CaseInsensitive
-
-                                source: SortFilterProxyModel {
-                                    id:           dexFilterProxy
-                                    filterRole:   dexFilter ? "isDexTx" : ""
-                                    filterString: dexFilter ? "true" : ""
-                                    filterSyntax: SortFilterProxyModel.FixedString
-                                    filterCaseSensitivity: Qt.CaseInsensitive
-                                    source: tableViewModel.transactions
-                                }
-                            }
-                        }
-                    }
-                }
-
-                sortOrder: transactionsTable.sortIndicatorOrder
-                sortCaseSensitivity: Qt.CaseInsensitive
-                sortRole: transactionsTable.getColumn(transactionsTable.sortIndicatorColumn).role + "Sort"
-                filterSyntax: SortFilterProxyModel.Wildcard
-            }
+            // sorted, filtered and paged by the model, the tabs and the sort column go to its query
+            model: tableViewModel.pagedTransactions
 
             rowDelegate: ExpandableRowDelegate {
                 id:         rowItemDelegate
                 collapsed:  true
-                rowInModel: styleData.row !== undefined && styleData.row >= 0 && styleData.row < txProxyModel.count
+                rowInModel: styleData.row !== undefined && styleData.row >= 0 && styleData.row < transactionsTable.model.count
                 rowHeight:  transactionsTable.rowHeight
 
                 backgroundColor: hovered
@@ -32,6 +32,35 @@ namespace
             return lf > rt;
         return lf < rt;
     }
+
+    // max privacy and offline addresses may share the SBBS address, the token tells them apart
+    std::string getAddressKey(const beam::wallet::WalletAddress& address)
+    {
+        return std::to_string(address.m_BbsAddr) + address.m_Token;
+    }
+
+    template<typename T, typename Comparer>
+    void insertSorted(QList<T*>& list, T* item, const Comparer& cmp)
+    {
+        list.insert(std::upper_bound(list.begin(), list.end(), item, cmp), item);
+    }
+
+    template<typename T, typename Comparer>
+    bool removeSorted(QList<T*>& list, T* item, const Comparer& cmp)
+    {
+        auto [first, last] = std::equal_range(list.begin(), list.end(), item, cmp);
+        auto it = std::find(first, last, item);
+        if (it == last)
+        {
+            return false;
+        }
+
+        list.erase(it);
+        return true;
+    }
+
+    // a timer interval is an int of milliseconds, far expirations are checked again later
+    constexpr beam::Timestamp kMaxExpirationWaitSec = 24 * 60 * 60;
 }
 
 ContactItem::ContactItem(const beam::wallet::WalletAddress& address)
@@ -71,20 +100,24 @@ QString ContactItem::getToken() const
 
 AddressBookViewModel::AddressBookViewModel()
     : m_model(AppModel::getInstance().getWalletModel())
+    , m_txStore(AppModel::getInstance().getTxStore())
 {
     connect(m_model,
             SIGNAL(addressesChanged(bool, const std::vector<beam::wallet::WalletAddress>&)),
             SLOT(onAddresses(bool, const std::vector<beam::wallet::WalletAddress>&)));
-    connect(m_model,
-            SIGNAL(transactionsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)),
-            SLOT(onTransactions(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)));
+    connect(m_txStore.get(), &TxStore::transactionsChanged, this, &AddressBookViewModel::onTransactions);
     connect(m_model,
             SIGNAL(addressesChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::WalletAddress>&)),
             SLOT(onAddressesChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::WalletAddress>&)));
 
+    m_expirationTimer.setSingleShot(true);
+    connect(&m_expirationTimer, &QTimer::timeout, this, &AddressBookViewModel::onAddressesExpired);
+
     getAddressesFromModel();
-    m_model->getAsync()->getTransactions();
-    startTimer(3 * 1000);
+    if (m_txStore->isLoaded())
+    {
+        onTransactions(beam::wallet::ChangeAction::Reset, m_txStore->getAll());
+    }
 }
 
 AddressBookViewModel::~AddressBookViewModel()
@@ -232,7 +265,7 @@ bool AddressBookViewModel::isWIDBusy(const QString& wid)
 {
     beam::wallet::WalletID walletID;
     walletID.FromHex(wid.toStdString());
-    return find(m_busyAddresses.cbegin(), m_busyAddresses.cend(), walletID) != m_busyAddresses.cend();
+    return m_busyAddresses.find(walletID) != m_busyAddresses.end();
 }
 
 void AddressBookViewModel::deleteAddress(const QString& token)
@@ -273,116 +306,263 @@ void AddressBookViewModel::onAddresses(bool own, const std::vector<beam::wallet:
     {
         qDeleteAll(m_activeAddresses); m_activeAddresses.clear();
         qDeleteAll(m_expiredAddresses); m_expiredAddresses.clear();
+        m_addressesByKey.clear();
+        m_addressesByWalletID.clear();
+        m_expirations.clear();
 
         for (const auto& addr : addresses)
         {
             assert(!addr.m_Token.empty());
-            if (addr.isExpired())
-            {
-                m_expiredAddresses.push_back(new AddressItem(addr));
-            }
-            else
-            {
-                m_activeAddresses.push_back(new AddressItem(addr));
-            }
+            addAddress(addr, false);
         }
 
         sortActiveAddresses();
         sortExpiredAddresses();
+        scheduleExpiration();
     }
     else
     {
         qDeleteAll(m_contacts); m_contacts.clear();
+        m_contactsByKey.clear();
 
         for (const auto& addr : addresses)
         {
-            m_contacts.push_back(new ContactItem(addr));
+            addAddress(addr, false);
         }
 
         sortContacts();
     }
 }
 
-void AddressBookViewModel::onAddressesChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::WalletAddress>& addresses)
+void AddressBookViewModel::onAddressesChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::WalletAddress>& addresses)
 {
-    // TODO: refactor this
-    getAddressesFromModel();
+    using namespace beam::wallet;
+
+    if (action == ChangeAction::Reset)
+    {
+        std::vector<WalletAddress> own;
+        std::vector<WalletAddress> contacts;
+        for (const auto& addr : addresses)
+        {
+            (addr.isOwn() ? own : contacts).push_back(addr);
+        }
+
+        onAddresses(true, own);
+        onAddresses(false, contacts);
+        return;
+    }
+
+    bool ownUpdated = false;
+    bool contactsUpdated = false;
+    for (const auto& addr : addresses)
+    {
+        removeAddress(addr);
+        if (action != ChangeAction::Removed)
+        {
+            addAddress(addr, true);
+        }
+        (addr.isOwn() ? ownUpdated : contactsUpdated) = true;
+    }
+
+    if (ownUpdated)
+    {
+        scheduleExpiration();
+        emit activeAddressesChanged();
+        emit expiredAddressesChanged();
+    }
+
+    if (contactsUpdated)
+    {
+        emit contactsChanged();
+    }
 }
 
 void AddressBookViewModel::onTransactions(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& transactions)
 {
     using namespace beam::wallet;
 
-    switch (action)
+    if (action == ChangeAction::Reset)
     {
-        case ChangeAction::Reset:
+        for (const auto& [walletID, count] : m_busyAddresses)
+        {
+            for (auto [it, last] = m_addressesByWalletID.equal_range(walletID); it != last; ++it)
             {
-                m_busyAddresses.clear();
-                // no beak!
+                it->second->setBusy(false);
             }
+        }
+        m_busyTxs.clear();
+        m_busyAddresses.clear();
+    }
 
-        case ChangeAction::Added:
-            {
-                for (const auto& tx : transactions)
-                {
-                    if (!tx.canDelete())    // only active transactions
-                    {
-                        m_busyAddresses.push_back(tx.m_myAddr);
-                    }
-                }
-                break;
-            }
-        
-        case ChangeAction::Updated:
-            {
-                for (const auto& tx : transactions)
-                {
-                    auto it = find(m_busyAddresses.cbegin(), m_busyAddresses.cend(), tx.m_myAddr);
-                    if (it != m_busyAddresses.cend() && tx.canDelete())
-                    {
-                        m_busyAddresses.erase(it);
-                    }
-                }
-                break;
-            }
+    for (const auto& tx : transactions)
+    {
+        // only active transactions keep the address busy
+        setTxBusy(tx, action != ChangeAction::Removed && !tx.canDelete());
+    }
+}
 
-        case ChangeAction::Removed:
-            {
-                for (const auto& tx : transactions)
-                {
-                    auto it = find(m_busyAddresses.cbegin(), m_busyAddresses.cend(), tx.m_myAddr);
-                    if (it != m_busyAddresses.cend())
-                    {
-                        m_busyAddresses.erase(it);
-                    }
-                }
-                break;
-            }
+void AddressBookViewModel::setTxBusy(const beam::wallet::TxDescription& tx, bool busy)
+{
+    auto it = m_busyTxs.find(tx.m_txId);
+    if (it != m_busyTxs.end())
+    {
+        if (busy && it->second == tx.m_myAddr)
+        {
+            return;
+        }
+
+        setAddressBusy(it->second, false);
+        m_busyTxs.erase(it);
+    }
+
+    if (busy)
+    {
+        m_busyTxs.emplace(tx.m_txId, tx.m_myAddr);
+        setAddressBusy(tx.m_myAddr, true);
+    }
+}
+
+// counts the active transactions of the address, its items are flagged when the first one comes and the last one goes
+void AddressBookViewModel::setAddressBusy(const beam::wallet::WalletID& walletID, bool busy)
+{
+    auto& count = m_busyAddresses[walletID];
+    count += busy ? 1 : -1;
+    assert(count >= 0);
+
+    if (count > 1 || (count == 1 && !busy))
+    {
+        return;
+    }
+
+    if (count == 0)
+    {
+        m_busyAddresses.erase(walletID);
+    }
 
-        default:
-            assert(false && "Unexpected action");
-            break;
+    for (auto [it, last] = m_addressesByWalletID.equal_range(walletID); it != last; ++it)
+    {
+        it->second->setBusy(busy);
     }
 }
 
-void AddressBookViewModel::timerEvent(QTimerEvent *event)
+void AddressBookViewModel::onAddressesExpired()
 {
-    auto firstExpired = std::remove_if(
-        m_activeAddresses.begin(), m_activeAddresses.end(), 
-        [](const AddressItem* addr) { return addr->isExpired(); });
+    auto activeCmp = generateAddrComparer(m_activeAddrSortRole, m_activeAddrSortOrder);
+    auto expiredCmp = generateAddrComparer(m_expiredAddrSortRole, m_expiredAddrSortOrder);
 
-    if (firstExpired != m_activeAddresses.end())
+    bool expired = false;
+    while (!m_expirations.empty() && m_expirations.begin()->second->isExpired())
     {
-        for (auto it = firstExpired; it != m_activeAddresses.end(); ++it)
+        auto* item = m_expirations.begin()->second;
+        m_expirations.erase(m_expirations.begin());
+        removeSorted(m_activeAddresses, item, activeCmp);
+        insertSorted(m_expiredAddresses, item, expiredCmp);
+        expired = true;
+    }
+
+    scheduleExpiration();
+
+    if (expired)
+    {
+        emit activeAddressesChanged();
+        emit expiredAddressesChanged();
+    }
+}
+
+// |keepSorted| is false while a whole list is loaded, it is sorted once afterwards
+void AddressBookViewModel::addAddress(const beam::wallet::WalletAddress& address, bool keepSorted)
+{
+    const auto key = getAddressKey(address);
+
+    if (!address.isOwn())
+    {
+        auto* item = new ContactItem(address);
+        m_contactsByKey[key] = item;
+        if (keepSorted)
+        {
+            insertSorted(m_contacts, item, generateContactComparer());
+        }
+        else
         {
-            m_expiredAddresses.push_back(*it);
+            m_contacts.push_back(item);
         }
+        return;
+    }
 
-        m_activeAddresses.erase(firstExpired, m_activeAddresses.end());
+    auto* item = new AddressItem(address);
+    item->setBusy(m_busyAddresses.find(address.m_BbsAddr) != m_busyAddresses.end());
+    m_addressesByKey[key] = item;
+    m_addressesByWalletID.emplace(address.m_BbsAddr, item);
 
-        emit activeAddressesChanged();
-        sortExpiredAddresses();
+    const bool expired = item->isExpired();
+    auto& list = expired ? m_expiredAddresses : m_activeAddresses;
+    if (keepSorted)
+    {
+        insertSorted(list, item, expired
+            ? generateAddrComparer(m_expiredAddrSortRole, m_expiredAddrSortOrder)
+            : generateAddrComparer(m_activeAddrSortRole, m_activeAddrSortOrder));
     }
+    else
+    {
+        list.push_back(item);
+    }
+
+    if (!expired && !item->isNeverExpired())
+    {
+        m_expirations.emplace(item->getExpirationTimestamp(), item);
+    }
+}
+
+void AddressBookViewModel::removeAddress(const beam::wallet::WalletAddress& address)
+{
+    const auto key = getAddressKey(address);
+
+    if (auto it = m_contactsByKey.find(key); it != m_contactsByKey.end())
+    {
+        removeSorted(m_contacts, it->second, generateContactComparer());
+        delete it->second;
+        m_contactsByKey.erase(it);
+    }
+
+    if (auto it = m_addressesByKey.find(key); it != m_addressesByKey.end())
+    {
+        auto* item = it->second;
+        m_expirations.erase({item->getExpirationTimestamp(), item});
+
+        // the expiration timer may not have moved it yet, so both lists are checked
+        if (!removeSorted(m_activeAddresses, item, generateAddrComparer(m_activeAddrSortRole, m_activeAddrSortOrder)))
+        {
+            removeSorted(m_expiredAddresses, item, generateAddrComparer(m_expiredAddrSortRole, m_expiredAddrSortOrder));
+        }
+
+        for (auto [byID, last] = m_addressesByWalletID.equal_range(item->getRawWalletID()); byID != last; ++byID)
+        {
+            if (byID->second == item)
+            {
+                m_addressesByWalletID.erase(byID);
+                break;
+            }
+        }
+
+        delete item;
+        m_addressesByKey.erase(it);
+    }
+}
+
+void AddressBookViewModel::scheduleExpiration()
+{
+    if (m_expirations.empty())
+    {
+        m_expirationTimer.stop();
+        return;
+    }
+
+    // an address is expired once the current time is past its expiration time,
+    // one whose clock check still disagrees is retried a second later
+    const auto now = beam::getTimestamp();
+    const auto expiration = m_expirations.begin()->first;
+    const auto waitSec = expiration >= now ? std::min(expiration - now + 1, kMaxExpirationWaitSec) : 1;
+    m_expirationTimer.start(static_cast<int>(waitSec * 1000));
 }
 
 void AddressBookViewModel::getAddressesFromModel()
@@ -19,8 +19,13 @@
 #include <QtCore/qvariant.h>
 #include <QDateTime>
 #include <QQmlListProperty>
+#include <QTimer>
+#include <set>
+#include <string_view>
+#include <unordered_map>
 #include "wallet/core/wallet_db.h"
 #include "model/wallet_model.h"
+#include "model/tx_store.h"
 #include "viewmodel/address_item.h"
 
 class ContactItem : public QObject
@@ -117,11 +122,16 @@ signals:
     void activeAddressesChanged();
     void expiredAddressesChanged();
 
-protected:
-    void timerEvent(QTimerEvent *event) override;
+private slots:
+    void onAddressesExpired();
 
 private:
     void getAddressesFromModel();
+    void addAddress(const beam::wallet::WalletAddress& address, bool keepSorted);
+    void removeAddress(const beam::wallet::WalletAddress& address);
+    void scheduleExpiration();
+    void setTxBusy(const beam::wallet::TxDescription& tx, bool busy);
+    void setAddressBusy(const beam::wallet::WalletID& walletID, bool busy);
     void sortActiveAddresses();
     void sortExpiredAddresses();
     void sortContacts();
@@ -130,7 +140,24 @@ private:
     std::function<bool(const ContactItem*, const ContactItem*)> generateContactComparer();
 
 private:
+    struct WalletIDHash
+    {
+        size_t operator()(const beam::wallet::WalletID& walletID) const
+        {
+            return std::hash<std::string_view>{}(std::string_view(reinterpret_cast<const char*>(walletID.m_Pk.m_pData), walletID.m_Pk.nBytes));
+        }
+    };
+
+    struct TxIDHash
+    {
+        size_t operator()(const beam::wallet::TxID& txID) const
+        {
+            return std::hash<std::string_view>{}(std::string_view(reinterpret_cast<const char*>(txID.data()), txID.size()));
+        }
+    };
+
     WalletModel::Ptr m_model;
+    TxStore::Ptr m_txStore;
     QList<ContactItem*> m_contacts;
     QList<AddressItem*> m_activeAddresses;
     QList<AddressItem*> m_expiredAddresses;
@@ -140,5 +167,17 @@ private:
     QString m_activeAddrSortRole;
     QString m_expiredAddrSortRole;
     QString m_contactSortRole;
-    std::vector<beam::wallet::WalletID> m_busyAddresses;
+
+    // active transactions by our address, an address stays busy while any of them is counted
+    std::unordered_map<beam::wallet::TxID, beam::wallet::WalletID, TxIDHash> m_busyTxs;
+    std::unordered_map<beam::wallet::WalletID, int, WalletIDHash> m_busyAddresses;
+
+    // items of the lists above by address key, the lists own them
+    std::unordered_map<std::string, AddressItem*> m_addressesByKey;
+    std::unordered_map<std::string, ContactItem*> m_contactsByKey;
+    std::unordered_multimap<beam::wallet::WalletID, AddressItem*, WalletIDHash> m_addressesByWalletID;
+
+    // active addresses which can expire, the earliest one sets the timer
+    std::set<std::pair<beam::Timestamp, AddressItem*>> m_expirations;
+    QTimer m_expirationTimer;
 };
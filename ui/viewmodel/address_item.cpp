@@ -85,3 +85,22 @@ beam::Timestamp AddressItem::getExpirationTimestamp() const
 {
     return m_walletAddress.getExpirationTime();
 }
+
+const beam::wallet::WalletID& AddressItem::getRawWalletID() const
+{
+    return m_walletAddress.m_BbsAddr;
+}
+
+bool AddressItem::isBusy() const
+{
+    return m_busy;
+}
+
+void AddressItem::setBusy(bool value)
+{
+    if (m_busy != value)
+    {
+        m_busy = value;
+        emit busyChanged();
+    }
+}
@@ -31,6 +31,7 @@ class AddressItem : public QObject
     Q_PROPERTY(bool      neverExpired     READ isNeverExpired    CONSTANT)
     Q_PROPERTY(bool      isExpired        READ isExpired         CONSTANT)
     Q_PROPERTY(QString   strView          READ getStrView        CONSTANT)
+    Q_PROPERTY(bool      busy             READ isBusy            NOTIFY busyChanged)
 
 public:
 
@@ -50,7 +51,16 @@ public:
     bool isExpired() const;
     beam::Timestamp getCreateTimestamp() const;
     beam::Timestamp getExpirationTimestamp() const;
+    const beam::wallet::WalletID& getRawWalletID() const;
+
+    // the address has an active transaction, kept up to date by AddressBookViewModel
+    bool isBusy() const;
+    void setBusy(bool value);
+
+signals:
+    void busyChanged();
 
 private:
     beam::wallet::WalletAddress m_walletAddress;
+    bool m_busy = false;
 };
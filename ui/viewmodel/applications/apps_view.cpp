@@ -317,6 +317,7 @@ namespace beamui::applications
 {
     AppsViewModel::AppsViewModel()
         : m_walletModel(AppModel::getInstance().getWalletModel())
+        , m_txStore(AppModel::getInstance().getTxStore())
         , m_appsModel(this)
         , m_publisherAppsModel(this)
     {
@@ -352,7 +353,7 @@ namespace beamui::applications
         else
         {
             _runApp = false;
-            connect(m_walletModel, &WalletModel::transactionsChanged, this, &AppsViewModel::onTransactionsChanged);
+            connect(m_txStore.get(), &TxStore::transactionsChanged, this, &AppsViewModel::onTransactionsChanged);
             connect(m_walletModel, &WalletModel::walletStatusChanged, this, &AppsViewModel::loadPublishers);
             connect(m_walletModel, &WalletModel::walletStatusChanged, this, &AppsViewModel::loadApps);
             // update the application info because the list of tracked publishers has changed
@@ -936,7 +937,7 @@ namespace beamui::applications
     QAbstractItemModel* AppsViewModel::getApps()
     {
         auto result = getAppsImpl();
-        m_appsModel.reset(result.begin(), result.end());
+        m_appsModel.reset(result.rbegin(), result.rend());
         return &m_appsModel;
     }
 
@@ -1811,7 +1812,7 @@ namespace beamui::applications
                 return appFieldsIt->toString() == publisherKey && app.contains(DApp::kIpfsId);
             }
         );
-        m_publisherAppsModel.reset(publisherApps.begin(), publisherApps.end());
+        m_publisherAppsModel.reset(publisherApps.rbegin(), publisherApps.rend());
         return &m_publisherAppsModel;
     }
 
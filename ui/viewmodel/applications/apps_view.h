@@ -17,6 +17,7 @@
 #include <boost/optional.hpp>
 #include "utility/common.h"
 #include "model/wallet_model.h"
+#include "model/tx_store.h"
 #include "viewmodel/helpers/list_model.h"
 
 namespace beamui::applications
@@ -223,6 +224,7 @@ namespace beamui::applications
         void checkManifestFile(QIODevice* ioDevice, const QString& expectedAppName, const QString& expectedGuid);
 
         WalletModel::Ptr m_walletModel;
+        TxStore::Ptr m_txStore;
 
         QString _userAgent;
         QString _serverAddr;
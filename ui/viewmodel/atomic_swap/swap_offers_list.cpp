@@ -104,3 +104,8 @@ QVariant SwapOffersList::data(const QModelIndex &index, int role) const
             return QVariant();
     }
 }
+
+beam::wallet::TxID SwapOffersList::keyOf(const std::shared_ptr<SwapOfferItem>& item) const
+{
+    return item->getTxID();
+}
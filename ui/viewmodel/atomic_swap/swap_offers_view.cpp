@@ -198,13 +198,12 @@ beam::Amount SwapCoinClientWrapper::getAvailable() const
 
 SwapOffersViewModel::SwapOffersViewModel()
     :   m_walletModel(AppModel::getInstance().getWalletModel())
+    ,   m_txStore(AppModel::getInstance().getTxStore())
 {
     InitSwapClientWrappers();
 
     connect(m_walletModel, &WalletModel::walletStatusChanged, this, &SwapOffersViewModel::beamAvailableChanged);
-    connect(m_walletModel,
-            SIGNAL(transactionsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)),
-            SLOT(onTransactionsDataModelChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)));
+    connect(m_txStore.get(), &TxStore::transactionsChanged, this, &SwapOffersViewModel::onTransactionsDataModelChanged);
 
     connect(m_walletModel,
             SIGNAL(swapOffersChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::SwapOffer>&)),
@@ -213,7 +212,10 @@ SwapOffersViewModel::SwapOffersViewModel()
     monitorAllOffersFitBalance();
 
     m_walletModel->getAsync()->getSwapOffers();
-    m_walletModel->getAsync()->getTransactions();
+    if (m_txStore->isLoaded())
+    {
+        onTransactionsDataModelChanged(beam::wallet::ChangeAction::Reset, m_txStore->getByType(beam::wallet::TxType::AtomicSwap));
+    }
 }
 
 SwapOffersViewModel::~SwapOffersViewModel()
@@ -423,7 +425,7 @@ void SwapOffersViewModel::onSwapOffersDataModelChanged(beam::wallet::ChangeActio
     {
         case ChangeAction::Reset:
             {
-                m_offersList.reset(modifiedOffers);
+                m_offersList.reset(std::move(modifiedOffers));
                 resetAllOffersFitBalance();
                 break;
             }
@@ -468,7 +470,7 @@ void SwapOffersViewModel::resetAllOffersFitBalance()
         if (isOfferFitBalance(*it))
             offersListFitBalance.push_back(it);
     }
-    m_offersListFitBalance.reset(offersListFitBalance);
+    m_offersListFitBalance.reset(std::move(offersListFitBalance));
     emit allOffersFitBalanceChanged();
 }
 
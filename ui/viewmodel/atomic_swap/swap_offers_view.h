@@ -17,6 +17,7 @@
 #include <QObject>
 #include <QQmlListProperty>
 #include "model/wallet_model.h"
+#include "model/tx_store.h"
 #include "model/swap_coin_client_model.h"
 #include "model/swap_eth_client_model.h"
 #include "swap_offers_list.h"
@@ -139,6 +140,7 @@ private:
     void setIsOffersLoaded(bool isOffersLoaded);
 
     WalletModel::Ptr m_walletModel;
+    TxStore::Ptr m_txStore;
 
     SwapTxObjectList m_transactionsList;
     SwapOffersList m_offersList;
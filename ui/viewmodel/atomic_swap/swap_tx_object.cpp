@@ -110,8 +110,9 @@ namespace
 }  // namespace
 
 SwapTxObject::SwapTxObject(const beam::wallet::TxDescription& tx, uint32_t lockTxMinConfirmations,
-    uint32_t withdrawTxMinConfirmations, double blocksPerHour, QObject* parent/* = nullptr*/)
-        : TxObject(tx, parent),
+    uint32_t withdrawTxMinConfirmations, double blocksPerHour)
+        : TxObject(tx),
+          m_tx(tx),
           m_swapTx(tx),
           m_lockTxMinConfirmations(lockTxMinConfirmations),
           m_withdrawTxMinConfirmations(withdrawTxMinConfirmations),
@@ -136,24 +137,24 @@ bool SwapTxObject::isExpired() const
 
 bool SwapTxObject::isInProgress() const
 {
-    return _tx.m_status == wallet::TxStatus::Pending ||
-           _tx.m_status == wallet::TxStatus::Registering ||
-           _tx.m_status == wallet::TxStatus::InProgress;
+    return m_tx.m_status == wallet::TxStatus::Pending ||
+           m_tx.m_status == wallet::TxStatus::Registering ||
+           m_tx.m_status == wallet::TxStatus::InProgress;
 }
 
 bool SwapTxObject::isPending() const
 {
-    return _tx.m_status == wallet::TxStatus::Pending;
+    return m_tx.m_status == wallet::TxStatus::Pending;
 }
 
 bool SwapTxObject::isCompleted() const
 {
-    return _tx.m_status == wallet::TxStatus::Completed;
+    return m_tx.m_status == wallet::TxStatus::Completed;
 }
 
 bool SwapTxObject::isCanceled() const
 {
-    return _tx.m_status == wallet::TxStatus::Canceled;
+    return m_tx.m_status == wallet::TxStatus::Canceled;
 }
 
 bool SwapTxObject::isFailed() const
@@ -168,9 +169,9 @@ bool SwapTxObject::isCancelAvailable() const
 
 bool SwapTxObject::isDeleteAvailable() const
 {
-    return _tx.m_status == wallet::TxStatus::Completed ||
-           _tx.m_status == wallet::TxStatus::Canceled ||
-           _tx.m_status == wallet::TxStatus::Failed;
+    return m_tx.m_status == wallet::TxStatus::Completed ||
+           m_tx.m_status == wallet::TxStatus::Canceled ||
+           m_tx.m_status == wallet::TxStatus::Failed;
 }
 
 auto SwapTxObject::getSwapCoinName() const -> QString
@@ -180,16 +181,16 @@ auto SwapTxObject::getSwapCoinName() const -> QString
 
 QString SwapTxObject::getSentAmountWithCurrency() const
 {
-    if (_tx.m_txType == beam::wallet::TxType::AtomicSwap)
+    if (m_tx.m_txType == beam::wallet::TxType::AtomicSwap)
     {
         return getSwapAmountWithCurrency(true);
     }
-    return _tx.m_sender ? getAmountWithCurrency() : "";
+    return m_tx.m_sender ? getAmountWithCurrency() : "";
 }
 
 QString SwapTxObject::getAmountWithCurrency() const
 {
-    return AmountToUIString(_tx.m_amount, beamui::Currencies::Beam);
+    return AmountToUIString(m_tx.m_amount, beamui::Currencies::Beam);
 }
 
 QString SwapTxObject::getSentAmount() const
@@ -200,21 +201,21 @@ QString SwapTxObject::getSentAmount() const
 
 beam::Amount SwapTxObject::getSentAmountValue() const
 {
-    if (_tx.m_txType == beam::wallet::TxType::AtomicSwap)
+    if (m_tx.m_txType == beam::wallet::TxType::AtomicSwap)
     {
         return getSwapAmountValue(true);
     }
 
-    return _tx.m_sender ? _tx.m_amount : 0;
+    return m_tx.m_sender ? m_tx.m_amount : 0;
 }
 
 QString SwapTxObject::getReceivedAmountWithCurrency() const
 {
-    if (_tx.m_txType == beam::wallet::TxType::AtomicSwap)
+    if (m_tx.m_txType == beam::wallet::TxType::AtomicSwap)
     {
         return getSwapAmountWithCurrency(false);
     }
-    return !_tx.m_sender ? getAmountWithCurrency() : "";
+    return !m_tx.m_sender ? getAmountWithCurrency() : "";
 }
 
 QString SwapTxObject::getReceivedAmount() const
@@ -225,11 +226,11 @@ QString SwapTxObject::getReceivedAmount() const
 
 beam::Amount SwapTxObject::getReceivedAmountValue() const
 {
-    if (_tx.m_txType == beam::wallet::TxType::AtomicSwap)
+    if (m_tx.m_txType == beam::wallet::TxType::AtomicSwap)
     {
         return getSwapAmountValue(false);
     }
-    return !_tx.m_sender ? _tx.m_amount : 0;
+    return !m_tx.m_sender ? m_tx.m_amount : 0;
 }
 
 QString SwapTxObject::getSwapAmountWithCurrency(bool sent) const
@@ -251,7 +252,7 @@ beam::Amount SwapTxObject::getSwapAmountValue(bool sent) const
     {
         return m_swapTx.getSwapAmount();
     }
-    return _tx.m_amount;
+    return m_tx.m_amount;
 }
 
 QString SwapTxObject::getFee() const
@@ -301,9 +302,9 @@ QString SwapTxObject::getFailureReason() const
 
 QString SwapTxObject::getStateDetails() const
 {
-    if (getTxDescription().m_txType == beam::wallet::TxType::AtomicSwap)
+    if (m_tx.m_txType == beam::wallet::TxType::AtomicSwap)
     {
-        switch (getTxDescription().m_status)
+        switch (m_tx.m_status)
         {
         case beam::wallet::TxStatus::Pending:
         case beam::wallet::TxStatus::InProgress:
@@ -352,7 +353,7 @@ beam::wallet::AtomicSwapCoin SwapTxObject::getSwapCoinType() const
 
 auto SwapTxObject::getStatus() const -> QString
 {
-    return beam::wallet::GetSwapTxStatusStr(getTxDescription()).c_str();
+    return beam::wallet::GetSwapTxStatusStr(m_tx).c_str();
 }
 
 namespace
@@ -19,11 +19,9 @@
 class SwapTxObject : public TxObject
 {
     // TODO: consider remove inheritance of TxObject
-    Q_OBJECT
-
 public:
     SwapTxObject(const beam::wallet::TxDescription& tx, uint32_t lockTxMinConfirmations,
-        uint32_t withdrawTxMinConfirmations, double blocksPerHour, QObject* parent = nullptr);
+        uint32_t withdrawTxMinConfirmations, double blocksPerHour);
     bool operator==(const SwapTxObject& other) const;
 
     auto getSentAmountWithCurrency() const -> QString;
@@ -65,12 +63,12 @@ public:
     bool isCanceled() const override;
     bool isFailed() const override;
 
-signals:
-
 private:
     auto getSwapAmountValue(bool sent) const -> beam::Amount;
     auto getSwapAmountWithCurrency(bool sent) const -> QString;
 
+    // swaps are few, they keep the description their swap parameters are read from
+    beam::wallet::TxDescription m_tx;
     beam::wallet::SwapTxDescription m_swapTx;
     uint32_t m_lockTxMinConfirmations = 0;
     uint32_t m_withdrawTxMinConfirmations = 0;
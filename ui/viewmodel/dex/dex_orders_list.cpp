@@ -174,6 +174,11 @@ QVariant DexOrdersList::data(const QModelIndex &index, int role) const
     }
 }
 
+beam::wallet::DexOrderID DexOrdersList::keyOf(const beam::wallet::DexOrder& order) const
+{
+    return order.getID();
+}
+
 void DexOrdersList::assetsListChanged()
 {
     emit layoutChanged();
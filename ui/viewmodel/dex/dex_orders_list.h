@@ -14,11 +14,11 @@
 #pragma once
 
 #include "model/assets_manager.h"
-#include "viewmodel/helpers/list_model.h"
+#include "viewmodel/helpers/keyed_list_model.h"
 #include "wallet/client/extensions/dex_board/dex_order.h"
 #include <QLocale>
 
-class DexOrdersList : public ListModel<beam::wallet::DexOrder>
+class DexOrdersList : public KeyedListModel<beam::wallet::DexOrder, beam::wallet::DexOrderID>
 {
     Q_OBJECT
 public:
@@ -56,6 +56,9 @@ public:
 public slots:
     void assetsListChanged();
 
+protected:
+    beam::wallet::DexOrderID keyOf(const beam::wallet::DexOrder& order) const override;
+
 private:
     QLocale m_locale; // default
     AssetsManager::Ptr m_amgr;
@@ -0,0 +1,76 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "core/block_crypt.h"
+#include "keyed_list_model.h"
+
+// Asset id -> keys of the rows showing that asset. Keys rather than row numbers are kept,
+// KeyedListModel moves rows on removal and resolves a key to its current row itself.
+template <typename Key, typename Hash = ListModelKeyHash>
+class AssetRowsIndex
+{
+public:
+    void add(beam::Asset::ID assetId, const Key& key)
+    {
+        _rows[assetId].insert(key);
+    }
+
+    void remove(beam::Asset::ID assetId, const Key& key)
+    {
+        auto it = _rows.find(assetId);
+        if (it == _rows.end())
+        {
+            return;
+        }
+
+        it->second.erase(key);
+        if (it->second.empty())
+        {
+            _rows.erase(it);
+        }
+    }
+
+    void clear()
+    {
+        _rows.clear();
+    }
+
+    // appends the rows currently showing |assetId| to |rows|
+    template <typename T>
+    void collectRows(beam::Asset::ID assetId, const KeyedListModel<T, Key, Hash>& list, std::vector<int>& rows) const
+    {
+        auto it = _rows.find(assetId);
+        if (it == _rows.end())
+        {
+            return;
+        }
+
+        for (const auto& key : it->second)
+        {
+            if (auto row = list.indexOf(key); row >= 0)
+            {
+                rows.push_back(row);
+            }
+        }
+    }
+
+private:
+    std::unordered_map<beam::Asset::ID, std::unordered_set<Key, Hash>> _rows;
+};
@@ -0,0 +1,282 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+#include "list_model.h"
+
+// Hashes the identifiers our list rows are keyed on: plain integers,
+// byte arrays (TxID) and uintBig-based ids (notification and DEX order ids).
+struct ListModelKeyHash
+{
+    template<typename K>
+    size_t operator()(const K& key) const
+    {
+        if constexpr (std::is_integral_v<K>)
+        {
+            return std::hash<K>{}(key);
+        }
+        else if constexpr (requires { key.m_pData; })
+        {
+            return std::hash<std::string_view>{}(std::string_view(reinterpret_cast<const char*>(key.m_pData), key.nBytes));
+        }
+        else
+        {
+            return std::hash<std::string_view>{}(std::string_view(reinterpret_cast<const char*>(key.data()), key.size()));
+        }
+    }
+};
+
+// ListModel which keeps a key -> row index, so update and remove do not scan the list.
+// New rows are appended, views are expected to sort through SortFilterProxyModel.
+template <typename T, typename Key, typename Hash = ListModelKeyHash>
+class KeyedListModel : public ListModel<T>
+{
+public:
+    KeyedListModel(QObject* pObj = nullptr)
+        : ListModel<T>(pObj)
+    {
+    }
+
+    int indexOf(const Key& key) const
+    {
+        auto it = m_index.find(key);
+        return it != m_index.end() ? it->second : -1;
+    }
+
+    bool contains(const Key& key) const
+    {
+        return m_index.find(key) != m_index.end();
+    }
+
+    void insert(const T& item)
+    {
+        upsert(item);
+    }
+
+    void insert_at(const T& item, int index)
+    {
+        if (auto row = indexOf(keyOf(item)); row >= 0)
+        {
+            replace(row, item);
+            return;
+        }
+
+        onItemAdded(item);
+        ListModel<T>::insert_at(item, index);
+        reindex(index);
+    }
+
+    void insert(const std::vector<T>& items)
+    {
+        update(items);
+    }
+
+    template<typename It>
+    void reset(It first, It last)
+    {
+        notifyReset(first, last);
+        ListModel<T>::reset(first, last);
+        rebuildIndex();
+    }
+
+    void reset(const std::vector<T>& items)
+    {
+        reset(items.begin(), items.end());
+    }
+
+    void reset(std::vector<T>&& items)
+    {
+        notifyReset(items.begin(), items.end());
+        ListModel<T>::reset(std::move(items));
+        rebuildIndex();
+    }
+
+    // Removes every contiguous range of the batch with its own removeRows, from the bottom up,
+    // so the surviving rows keep their identity for persistent indexes, selections and proxies.
+    void remove(const std::vector<T>& items)
+    {
+        std::vector<int> rows;
+        rows.reserve(items.size());
+        for (const auto& item : items)
+        {
+            auto it = m_index.find(keyOf(item));
+            if (it != m_index.end())
+            {
+                onItemRemoved(this->m_list[it->second]);
+                rows.push_back(it->second);
+                m_index.erase(it);
+            }
+        }
+
+        if (rows.empty())
+        {
+            return;
+        }
+
+        std::sort(rows.begin(), rows.end());
+
+        auto it = rows.rbegin();
+        while (it != rows.rend())
+        {
+            const int last = *it;
+            int first = last;
+            while (++it != rows.rend() && *it == first - 1)
+            {
+                first = *it;
+            }
+
+            this->beginRemoveRows(QModelIndex(), first, last);
+            this->m_list.erase(this->m_list.begin() + first, this->m_list.begin() + last + 1);
+            this->endRemoveRows();
+        }
+
+        // rows above the first removed one have shifted
+        reindex(rows.front());
+    }
+
+    // Replaces known rows in place and appends the new ones,
+    // emitting one dataChanged per range of touched rows and a single insertRows.
+    void update(const std::vector<T>& items)
+    {
+        std::vector<int> changed;
+        std::vector<T> added;
+        std::unordered_map<Key, size_t, Hash> addedIndex;
+
+        for (const auto& item : items)
+        {
+            auto key = keyOf(item);
+            if (auto row = indexOf(key); row >= 0)
+            {
+                onItemRemoved(this->m_list[row]);
+                this->m_list[row] = item;
+                onItemAdded(item);
+                changed.push_back(row);
+            }
+            else if (auto it = addedIndex.find(key); it != addedIndex.end())
+            {
+                added[it->second] = item;
+            }
+            else
+            {
+                addedIndex.emplace(std::move(key), added.size());
+                added.push_back(item);
+            }
+        }
+
+        std::sort(changed.begin(), changed.end());
+        touchRanges(changed);
+
+        if (added.empty())
+        {
+            return;
+        }
+
+        const int first = this->m_list.size();
+        this->beginInsertRows(QModelIndex(), first, first + int(added.size()) - 1);
+        this->m_list.reserve(first + int(added.size()));
+        for (auto& item : added)
+        {
+            m_index[keyOf(item)] = this->m_list.size();
+            onItemAdded(item);
+            this->m_list.push_back(std::move(item));
+        }
+        this->endInsertRows();
+    }
+
+protected:
+    virtual Key keyOf(const T& item) const = 0;
+
+    // |rows| must be sorted, rows separated by a small gap are reported together,
+    // re-reading a few untouched rows is cheaper than an extra signal for every view
+    void touchRanges(const std::vector<int>& rows, const QVector<int>& roles = QVector<int>())
+    {
+        constexpr int kMaxGap = 16;
+
+        auto it = rows.begin();
+        while (it != rows.end())
+        {
+            const int first = *it;
+            int last = first;
+            while (++it != rows.end() && *it - last <= kMaxGap)
+            {
+                last = *it;
+            }
+            this->touch(first, last, roles);
+        }
+    }
+
+    // called for every item entering or leaving the list, a replaced item is removed and added back
+    virtual void onItemAdded(const T&) {}
+    virtual void onItemRemoved(const T&) {}
+    virtual void onItemsCleared() {}
+
+private:
+    void upsert(const T& item)
+    {
+        if (auto row = indexOf(keyOf(item)); row >= 0)
+        {
+            replace(row, item);
+            return;
+        }
+
+        const int row = this->m_list.size();
+        this->beginInsertRows(QModelIndex(), row, row);
+        this->m_list.push_back(item);
+        m_index[keyOf(item)] = row;
+        onItemAdded(item);
+        this->endInsertRows();
+    }
+
+    void replace(int row, const T& item)
+    {
+        onItemRemoved(this->m_list[row]);
+        this->m_list[row] = item;
+        onItemAdded(item);
+        this->touch(row);
+    }
+
+    void rebuildIndex()
+    {
+        m_index.clear();
+        m_index.reserve(this->m_list.size());
+        reindex(0);
+    }
+
+    // runs before the model reset, so views refreshing on modelReset see the new items
+    template<typename It>
+    void notifyReset(It first, It last)
+    {
+        onItemsCleared();
+        for (auto it = first; it != last; ++it)
+        {
+            onItemAdded(*it);
+        }
+    }
+
+    void reindex(int from)
+    {
+        for (int row = from; row < this->m_list.size(); ++row)
+        {
+            m_index[keyOf(this->m_list[row])] = row;
+        }
+    }
+
+    std::unordered_map<Key, int, Hash> m_index;
+};
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <iterator>
 #include <memory>
 
 #include <QAbstractListModel>
@@ -86,12 +87,12 @@ public:
     template<typename It>
     void reset(It first, It last)
     {
-        int row = 0;
         beginResetModel();
         m_list.clear();
+        m_list.reserve(static_cast<int>(std::distance(first, last)));
         for (auto it = first; it != last; ++it)
         {
-            m_list.insert(row, *it);
+            m_list.push_back(*it);
         }
         endResetModel();
     }
@@ -101,6 +102,12 @@ public:
         reset(items.begin(), items.end());
     }
 
+    void reset(std::vector<T>&& items)
+    {
+        reset(std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+        items.clear();
+    }
+
     T get(int index) const
     {
         return m_list.at(index);
@@ -168,6 +175,17 @@ public:
         return true;
     }
 
+    bool touch(int first, int last, const QVector<int>& roles = QVector<int>())
+    {
+        if (first < 0 || last >= m_list.size() || first > last)
+        {
+            return false;
+        }
+
+        emit dataChanged(createIndex(first, 0), createIndex(last, 0), roles);
+        return true;
+    }
+
 protected:
     QList<T> m_list;
 };
@@ -0,0 +1,278 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+// Allocates list rows together with their shared_ptr control blocks from arenas of
+// fixed size blocks. Each reset of a list starts a new generation: its rows go to
+// other arenas than the previous ones, and an arena of a past generation goes back
+// to the pool as a whole once its last row is released. Blocks freed while their
+// generation is current are reused by the next rows. Rows may be built off the UI thread.
+template <typename Row>
+class RowPool
+{
+    class Pool;
+
+public:
+    template <typename T>
+    class Allocator
+    {
+    public:
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = Allocator<U>;
+        };
+
+        Allocator() = default;
+
+        template <typename U>
+        Allocator(const Allocator<U>&)
+        {
+        }
+
+        T* allocate(size_t n)
+        {
+            return static_cast<T*>(instance().allocate(n * sizeof(T)));
+        }
+
+        void deallocate(T* p, size_t)
+        {
+            instance().deallocate(p);
+        }
+
+        template <typename U>
+        bool operator==(const Allocator<U>&) const
+        {
+            return true;
+        }
+
+        template <typename U>
+        bool operator!=(const Allocator<U>&) const
+        {
+            return false;
+        }
+    };
+
+    template <typename... Args>
+    static std::shared_ptr<Row> make(Args&&... args)
+    {
+        return std::allocate_shared<Row>(Allocator<Row>(), std::forward<Args>(args)...);
+    }
+
+    // rows made after this call do not share arenas with the ones made before
+    static void nextGeneration()
+    {
+        instance().nextGeneration();
+    }
+
+private:
+    static_assert(alignof(Row) <= alignof(std::max_align_t), "over-aligned rows are not supported");
+
+    // never destroyed, rows may be released during static destruction
+    static Pool& instance()
+    {
+        static auto* pool = new Pool();
+        return *pool;
+    }
+
+    class Pool
+    {
+    public:
+        void* allocate(size_t size)
+        {
+            std::lock_guard lock(_mutex);
+
+            if (_blockSize == 0)
+            {
+                _blockSize = alignUp(size);
+            }
+
+            if (size > _blockSize)
+            {
+                // allocate_shared asks for one size only, anything else is not worth a pool
+                auto* header = static_cast<Header*>(::operator new(kHeaderSize + size));
+                header->arena = nullptr;
+                return payload(header);
+            }
+
+            if (_open.empty())
+            {
+                auto* arena = takeArena();
+                arena->generation = _generation;
+                arena->open = true;
+                _open.push_back(arena);
+            }
+
+            auto* arena = _open.back();
+            Header* header = nullptr;
+            if (arena->free)
+            {
+                header = reinterpret_cast<Header*>(arena->free);
+                arena->free = arena->free->next;
+            }
+            else
+            {
+                header = reinterpret_cast<Header*>(arena->storage + arena->bumped * stride());
+                ++arena->bumped;
+            }
+
+            header->arena = arena;
+            ++arena->live;
+
+            if (!arena->free && arena->bumped == kBlocksPerArena)
+            {
+                arena->open = false;
+                _open.pop_back();
+            }
+
+            return payload(header);
+        }
+
+        void deallocate(void* p)
+        {
+            auto* header = reinterpret_cast<Header*>(static_cast<std::byte*>(p) - kHeaderSize);
+            if (!header->arena)
+            {
+                ::operator delete(header);
+                return;
+            }
+
+            std::lock_guard lock(_mutex);
+
+            auto* arena = header->arena;
+            auto* block = reinterpret_cast<FreeBlock*>(header);
+            block->next = arena->free;
+            arena->free = block;
+            --arena->live;
+
+            if (arena->generation != _generation)
+            {
+                if (arena->live == 0)
+                {
+                    releaseArena(arena);
+                }
+            }
+            else if (!arena->open)
+            {
+                arena->open = true;
+                _open.push_back(arena);
+            }
+        }
+
+        void nextGeneration()
+        {
+            std::lock_guard lock(_mutex);
+
+            ++_generation;
+            for (auto* arena : _open)
+            {
+                arena->open = false;
+                if (arena->live == 0)
+                {
+                    releaseArena(arena);
+                }
+            }
+            _open.clear();
+        }
+
+    private:
+        static constexpr size_t kHeaderSize = alignof(std::max_align_t);
+        static constexpr size_t kBlocksPerArena = 256;
+        // a couple of arenas are enough to rebuild a list without going to the heap
+        static constexpr size_t kMaxSpareArenas = 4;
+
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        struct Arena
+        {
+            std::byte* storage = nullptr;
+            FreeBlock* free = nullptr;
+            size_t bumped = 0;
+            size_t live = 0;
+            uint64_t generation = 0;
+            bool open = false;
+        };
+
+        struct Header
+        {
+            Arena* arena;
+        };
+
+        static_assert(sizeof(Header) <= kHeaderSize);
+
+        static size_t alignUp(size_t size)
+        {
+            return (size + kHeaderSize - 1) / kHeaderSize * kHeaderSize;
+        }
+
+        static void* payload(Header* header)
+        {
+            return reinterpret_cast<std::byte*>(header) + kHeaderSize;
+        }
+
+        size_t stride() const
+        {
+            return kHeaderSize + _blockSize;
+        }
+
+        Arena* takeArena()
+        {
+            if (!_spare.empty())
+            {
+                auto* arena = _spare.back();
+                _spare.pop_back();
+                return arena;
+            }
+
+            auto* arena = new Arena();
+            arena->storage = static_cast<std::byte*>(::operator new(kBlocksPerArena * stride()));
+            return arena;
+        }
+
+        // the whole arena is recycled at once, its blocks are not returned one by one
+        void releaseArena(Arena* arena)
+        {
+            if (_spare.size() < kMaxSpareArenas)
+            {
+                arena->free = nullptr;
+                arena->bumped = 0;
+                arena->live = 0;
+                _spare.push_back(arena);
+                return;
+            }
+
+            ::operator delete(arena->storage);
+            delete arena;
+        }
+
+        std::mutex _mutex;
+        size_t _blockSize = 0;
+        uint64_t _generation = 0;
+        std::vector<Arena*> _open;
+        std::vector<Arena*> _spare;
+    };
+};
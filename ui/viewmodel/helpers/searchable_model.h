@@ -0,0 +1,28 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <QString>
+
+// Implemented by models which can answer case-insensitive substring queries
+// over a role without reading the role value of every row.
+class SearchableModel
+{
+public:
+    virtual ~SearchableModel() = default;
+
+    // returns false if |role| is not indexed, the caller should match the role value itself
+    virtual bool matchesRow(int row, int role, const QString& text, bool& matches) const = 0;
+};
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "sortfilterproxymodel.h"
+#include <QDateTime>
 
 SortFilterProxyModel::SortFilterProxyModel(QObject *parent) 
     : QSortFilterProxyModel(parent)
@@ -22,6 +23,14 @@ SortFilterProxyModel::SortFilterProxyModel(QObject *parent)
     connect(this, &QAbstractItemModel::rowsRemoved, this, &SortFilterProxyModel::countChanged);
     connect(this, &QAbstractItemModel::modelReset, this, &SortFilterProxyModel::countChanged);
     connect(this, &QAbstractItemModel::layoutChanged, this, &SortFilterProxyModel::countChanged);
+    connect(this, &QSortFilterProxyModel::sortCaseSensitivityChanged, this, &SortFilterProxyModel::resetSortKeys);
+
+    connect(this, &QAbstractItemModel::dataChanged, this, &SortFilterProxyModel::resetCachedRow);
+    connect(this, &QAbstractItemModel::rowsInserted, this, &SortFilterProxyModel::resetCachedRow);
+    connect(this, &QAbstractItemModel::rowsRemoved, this, &SortFilterProxyModel::resetCachedRow);
+    connect(this, &QAbstractItemModel::rowsMoved, this, &SortFilterProxyModel::resetCachedRow);
+    connect(this, &QAbstractItemModel::modelReset, this, &SortFilterProxyModel::resetCachedRow);
+    connect(this, &QAbstractItemModel::layoutChanged, this, &SortFilterProxyModel::resetCachedRow);
 }
 
 int SortFilterProxyModel::count() const
@@ -39,6 +48,42 @@ void SortFilterProxyModel::setSource(QObject *source)
     setSourceModel(qobject_cast<QAbstractItemModel *>(source));
 }
 
+void SortFilterProxyModel::setSourceModel(QAbstractItemModel *source)
+{
+    if (source == sourceModel())
+        return;
+
+    for (const auto& c : m_sourceConnections)
+        disconnect(c);
+    m_sourceConnections.clear();
+    resetSortKeys();
+    resetRoles();
+
+    // connected before the base class, so the keys are up to date when the proxy re-sorts
+    if (source) {
+        m_sourceConnections = {
+            connect(source, &QAbstractItemModel::rowsInserted, this, &SortFilterProxyModel::onSourceRowsInserted),
+            connect(source, &QAbstractItemModel::rowsRemoved, this, &SortFilterProxyModel::onSourceRowsRemoved),
+            connect(source, &QAbstractItemModel::dataChanged, this, &SortFilterProxyModel::onSourceDataChanged),
+            connect(source, &QAbstractItemModel::rowsMoved, this, &SortFilterProxyModel::resetSortKeys),
+            connect(source, &QAbstractItemModel::modelReset, this, &SortFilterProxyModel::resetSortKeys),
+            connect(source, &QAbstractItemModel::modelReset, this, &SortFilterProxyModel::resetRoles),
+            connect(source, &QAbstractItemModel::layoutChanged, this, &SortFilterProxyModel::resetSortKeys)
+        };
+    }
+
+    m_searchableSource = dynamic_cast<const SearchableModel *>(source);
+    QSortFilterProxyModel::setSourceModel(source);
+}
+
+bool SortFilterProxyModel::matchesRow(int row, int role, const QString &text, bool &matches) const
+{
+    if (!m_searchableSource)
+        return false;
+    QModelIndex sourceIndex = mapToSource(index(row, 0));
+    return sourceIndex.isValid() && m_searchableSource->matchesRow(sourceIndex.row(), role, text, matches);
+}
+
 QByteArray SortFilterProxyModel::sortRole() const
 {
     return m_sortRole;
@@ -48,6 +93,7 @@ void SortFilterProxyModel::setSortRole(const QByteArray &role)
 {
     if (m_sortRole != role) {
         m_sortRole = role;
+        resetSortKeys();
         if (m_complete)
             QSortFilterProxyModel::setSortRole(roleKey(role));
     }
@@ -58,6 +104,21 @@ void SortFilterProxyModel::setSortOrder(Qt::SortOrder order)
     QSortFilterProxyModel::sort(0, order);
 }
 
+bool SortFilterProxyModel::typedSort() const
+{
+    return m_typedSort;
+}
+
+void SortFilterProxyModel::setTypedSort(bool value)
+{
+    if (m_typedSort != value) {
+        m_typedSort = value;
+        resetSortKeys();
+        if (m_complete)
+            invalidate();
+    }
+}
+
 QByteArray SortFilterProxyModel::filterRole() const
 {
     return m_filterRole;
@@ -94,31 +155,29 @@ void SortFilterProxyModel::setFilterSyntax(SortFilterProxyModel::FilterSyntax sy
 
 QVariantMap SortFilterProxyModel::get(int idx) const
 {
-    QVariantMap map;
-    if (idx >= 0 && idx < count()) {
-        QHash<int, QByteArray> roles = roleNames();
-        QHashIterator<int, QByteArray> it(roles);
-        while (it.hasNext()) {
-            it.next();
-            auto roleName = QString::fromUtf8(it.value());
-            map[roleName] = data(index(idx, 0), it.key());
-        }
+    if (idx < 0 || idx >= count())
+        return QVariantMap();
+
+    if (!m_rolesValid)
+        buildRoles();
+
+    if (idx != m_cachedRow) {
+        // keys are in place already, only the values of the new row are written
+        QModelIndex rowIndex = index(idx, 0);
+        auto role = m_mapRoles.begin();
+        for (auto it = m_cachedRowMap.begin(); it != m_cachedRowMap.end(); ++it, ++role)
+            it.value() = data(rowIndex, *role);
+        m_cachedRow = idx;
     }
-    return map;
+    return m_cachedRowMap;
 }
 
 QVariant SortFilterProxyModel::getRoleValue(int idx, QByteArray roleName) const
 {
-    QHash<int, QByteArray> roles = roleNames();
-    QHashIterator<int, QByteArray> it(roles);
-    while (it.hasNext()) {
-        it.next();
-        if (roleName == it.value())
-        {
-            return data(index(idx, 0), it.key());
-        }
-    }
-    return QVariant();
+    int role = roleKey(roleName);
+    if (role < 0)
+        return QVariant();
+    return data(index(idx, 0), role);
 }
 
 void SortFilterProxyModel::classBegin()
@@ -128,22 +187,52 @@ void SortFilterProxyModel::classBegin()
 void SortFilterProxyModel::componentComplete()
 {
     m_complete = true;
-    if (!m_sortRole.isEmpty())
+    if (!m_sortRole.isEmpty()) {
+        resetSortKeys();
         QSortFilterProxyModel::setSortRole(roleKey(m_sortRole));
+    }
     if (!m_filterRole.isEmpty())
         QSortFilterProxyModel::setFilterRole(roleKey(m_filterRole));
 }
 
 int SortFilterProxyModel::roleKey(const QByteArray &role) const
 {
+    if (!m_rolesValid)
+        buildRoles();
+    return m_roleKeys.value(role, -1);
+}
+
+void SortFilterProxyModel::buildRoles() const
+{
+    m_roleKeys.clear();
+    m_mapRoles.clear();
+    m_cachedRowMap.clear();
+    m_cachedRow = -1;
+
     QHash<int, QByteArray> roles = roleNames();
     QHashIterator<int, QByteArray> it(roles);
     while (it.hasNext()) {
         it.next();
-        if (it.value() == role)
-            return it.key();
+        m_roleKeys.insert(it.value(), it.key());
+        m_cachedRowMap.insert(QString::fromUtf8(it.value()), QVariant());
     }
-    return -1;
+
+    m_mapRoles.reserve(m_cachedRowMap.size());
+    for (auto key = m_cachedRowMap.keyBegin(); key != m_cachedRowMap.keyEnd(); ++key)
+        m_mapRoles.push_back(m_roleKeys.value(key->toUtf8()));
+
+    m_rolesValid = true;
+}
+
+void SortFilterProxyModel::resetRoles()
+{
+    m_rolesValid = false;
+    m_cachedRow = -1;
+}
+
+void SortFilterProxyModel::resetCachedRow()
+{
+    m_cachedRow = -1;
 }
 
 QHash<int, QByteArray> SortFilterProxyModel::roleNames() const
@@ -160,20 +249,154 @@ bool SortFilterProxyModel::filterAcceptsRow(int sourceRow, const QModelIndex &so
         return true;
     QAbstractItemModel *model = sourceModel();
     if (filterRole().isEmpty()) {
-        QHash<int, QByteArray> roles = roleNames();
-        QHashIterator<int, QByteArray> it(roles);
-        while (it.hasNext()) {
-            it.next();
-            QModelIndex sourceIndex = model->index(sourceRow, 0, sourceParent);
-            QString key = model->data(sourceIndex, it.key()).toString();
+        if (!m_rolesValid)
+            buildRoles();
+        QModelIndex sourceIndex = model->index(sourceRow, 0, sourceParent);
+        for (int role : m_mapRoles) {
+            QString key = model->data(sourceIndex, role).toString();
             if (key.contains(rx))
                 return true;
         }
         return false;
     }
+    if (m_searchableSource && !sourceParent.isValid() && isPlainFilter(rx)) {
+        bool matches = false;
+        if (m_searchableSource->matchesRow(sourceRow, roleKey(filterRole()), rx.pattern(), matches))
+            return matches;
+    }
     QModelIndex sourceIndex = model->index(sourceRow, 0, sourceParent);
     if (!sourceIndex.isValid())
         return true;
     QString key = model->data(sourceIndex, roleKey(filterRole())).toString();
     return key.contains(rx);
 }
+
+// a case-insensitive pattern without wildcards is a plain substring search
+bool SortFilterProxyModel::isPlainFilter(const QRegExp &rx) const
+{
+    if (rx.caseSensitivity() != Qt::CaseInsensitive)
+        return false;
+    switch (rx.patternSyntax()) {
+    case QRegExp::FixedString:
+        return true;
+    case QRegExp::Wildcard:
+    case QRegExp::WildcardUnix: {
+        static const QRegExp wildcards(QStringLiteral("[*?\\[\\]\\\\]"));
+        return !rx.pattern().contains(wildcards);
+    }
+    default:
+        return false;
+    }
+}
+
+bool SortFilterProxyModel::lessThan(const QModelIndex &left, const QModelIndex &right) const
+{
+    if (!m_typedSort || left.parent().isValid())
+        return QSortFilterProxyModel::lessThan(left, right);
+
+    if (!m_sortKeysValid)
+        buildSortKeys();
+
+    const auto size = static_cast<int>(m_sortKeys.size());
+    if (left.row() >= size || right.row() >= size)
+        return QSortFilterProxyModel::lessThan(left, right);
+
+    return m_sortKeys[left.row()] < m_sortKeys[right.row()];
+}
+
+SortFilterProxyModel::SortKey SortFilterProxyModel::makeSortKey(int sourceRow) const
+{
+    QAbstractItemModel *model = sourceModel();
+    const auto value = model->data(model->index(sourceRow, qMax(sortColumn(), 0)), QSortFilterProxyModel::sortRole());
+
+    switch (static_cast<QMetaType::Type>(value.userType())) {
+    case QMetaType::Bool:
+    case QMetaType::UChar:
+    case QMetaType::UShort:
+    case QMetaType::UInt:
+    case QMetaType::ULong:
+    case QMetaType::ULongLong:
+        return value.toULongLong();
+    case QMetaType::Char:
+    case QMetaType::SChar:
+    case QMetaType::Short:
+    case QMetaType::Int:
+    case QMetaType::Long:
+    case QMetaType::LongLong:
+        return value.toLongLong();
+    case QMetaType::Float:
+    case QMetaType::Double:
+        return value.toDouble();
+    case QMetaType::QDateTime:
+        return static_cast<qlonglong>(value.toDateTime().toMSecsSinceEpoch());
+    default:
+        return sortCaseSensitivity() == Qt::CaseInsensitive
+            ? value.toString().toCaseFolded()
+            : value.toString();
+    }
+}
+
+void SortFilterProxyModel::buildSortKeys() const
+{
+    m_sortKeys.clear();
+    if (QAbstractItemModel *model = sourceModel()) {
+        const int count = model->rowCount();
+        m_sortKeys.reserve(count);
+        for (int row = 0; row < count; ++row)
+            m_sortKeys.push_back(makeSortKey(row));
+    }
+    m_sortKeysValid = true;
+}
+
+void SortFilterProxyModel::resetSortKeys()
+{
+    m_sortKeysValid = false;
+    m_sortKeys.clear();
+}
+
+void SortFilterProxyModel::onSourceRowsInserted(const QModelIndex &parent, int first, int last)
+{
+    if (!m_sortKeysValid || parent.isValid())
+        return;
+
+    if (first > static_cast<int>(m_sortKeys.size())) {
+        resetSortKeys();
+        return;
+    }
+
+    std::vector<SortKey> keys;
+    keys.reserve(last - first + 1);
+    for (int row = first; row <= last; ++row)
+        keys.push_back(makeSortKey(row));
+    m_sortKeys.insert(m_sortKeys.begin() + first, std::make_move_iterator(keys.begin()), std::make_move_iterator(keys.end()));
+}
+
+void SortFilterProxyModel::onSourceRowsRemoved(const QModelIndex &parent, int first, int last)
+{
+    if (!m_sortKeysValid || parent.isValid())
+        return;
+
+    if (last >= static_cast<int>(m_sortKeys.size())) {
+        resetSortKeys();
+        return;
+    }
+
+    m_sortKeys.erase(m_sortKeys.begin() + first, m_sortKeys.begin() + last + 1);
+}
+
+void SortFilterProxyModel::onSourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles)
+{
+    if (!m_sortKeysValid || topLeft.parent().isValid())
+        return;
+
+    if (!roles.isEmpty() && !roles.contains(QSortFilterProxyModel::sortRole()))
+        return;
+
+    if (bottomRight.row() >= static_cast<int>(m_sortKeys.size())) {
+        resetSortKeys();
+        return;
+    }
+
+    for (int row = topLeft.row(); row <= bottomRight.row(); ++row)
+        m_sortKeys[row] = makeSortKey(row);
+}
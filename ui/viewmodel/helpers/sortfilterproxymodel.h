@@ -15,8 +15,11 @@
 
 #include <QtCore/qsortfilterproxymodel.h>
 #include <QtQml/qqmlparserstatus.h>
+#include <variant>
+#include <vector>
+#include "searchable_model.h"
 
-class SortFilterProxyModel : public QSortFilterProxyModel, public QQmlParserStatus
+class SortFilterProxyModel : public QSortFilterProxyModel, public QQmlParserStatus, public SearchableModel
 {
     Q_OBJECT
     Q_INTERFACES(QQmlParserStatus)
@@ -26,6 +29,7 @@ class SortFilterProxyModel : public QSortFilterProxyModel, public QQmlParserStat
 
     Q_PROPERTY(QByteArray sortRole READ sortRole WRITE setSortRole)
     Q_PROPERTY(Qt::SortOrder sortOrder READ sortOrder WRITE setSortOrder)
+    Q_PROPERTY(bool typedSort READ typedSort WRITE setTypedSort)
 
     Q_PROPERTY(QByteArray filterRole READ filterRole WRITE setFilterRole)
     Q_PROPERTY(QString filterString READ filterString WRITE setFilterString)
@@ -44,6 +48,9 @@ public:
 
     void setSortOrder(Qt::SortOrder order);
 
+    bool typedSort() const;
+    void setTypedSort(bool value);
+
     QByteArray filterRole() const;
     void setFilterRole(const QByteArray &role);
 
@@ -66,6 +73,11 @@ public:
     void classBegin();
     void componentComplete();
 
+    void setSourceModel(QAbstractItemModel *sourceModel) override;
+
+    // forwards the query to the source model, so an index below a chain of proxies is still used
+    bool matchesRow(int row, int role, const QString &text, bool &matches) const override;
+
 signals:
     void countChanged();
 
@@ -73,9 +85,39 @@ protected:
     int roleKey(const QByteArray &role) const;
     QHash<int, QByteArray> roleNames() const;
     bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const;
+    bool lessThan(const QModelIndex &left, const QModelIndex &right) const override;
 
 private:
+    // sort role value of a source row, compared without QVariant boxing
+    using SortKey = std::variant<qulonglong, qlonglong, double, QString>;
+
+    SortKey makeSortKey(int sourceRow) const;
+    void buildSortKeys() const;
+    bool isPlainFilter(const QRegExp &rx) const;
+    void buildRoles() const;
+    void resetRoles();
+    void resetCachedRow();
+    void resetSortKeys();
+    void onSourceRowsInserted(const QModelIndex &parent, int first, int last);
+    void onSourceRowsRemoved(const QModelIndex &parent, int first, int last);
+    void onSourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles);
+
     bool m_complete;
     QByteArray m_sortRole;
     QByteArray m_filterRole;
+
+    bool m_typedSort = false;
+    mutable bool m_sortKeysValid = false;
+    mutable std::vector<SortKey> m_sortKeys;
+    std::vector<QMetaObject::Connection> m_sourceConnections;
+    const SearchableModel *m_searchableSource = nullptr;
+
+    // role names of the source, resolved once per source model
+    mutable bool m_rolesValid = false;
+    mutable QHash<QByteArray, int> m_roleKeys;
+    mutable std::vector<int> m_mapRoles;   // role ids in the key order of m_cachedRowMap
+
+    // last row returned by get(), its values are overwritten in place for the next row
+    mutable int m_cachedRow = -1;
+    mutable QVariantMap m_cachedRowMap;
 };
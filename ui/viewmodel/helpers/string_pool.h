@@ -0,0 +1,45 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QSet>
+#include <QString>
+#include <mutex>
+
+// Shares one copy of the strings repeated across many list rows (DApp names and ids,
+// contract ids, asset names). QString is implicitly shared, so rows holding the pooled
+// value keep a reference instead of their own buffer. Only low-cardinality values
+// should go here: the pool never shrinks. Rows may be built off the UI thread.
+class StringPool
+{
+public:
+    static QString intern(const QString& value)
+    {
+        if (value.isEmpty())
+        {
+            return QString();
+        }
+
+        static std::mutex mutex;
+        static QSet<QString> pool;
+
+        std::lock_guard lock(mutex);
+        auto it = pool.constFind(value);
+        if (it == pool.constEnd())
+        {
+            it = pool.insert(value);
+        }
+        return *it;
+    }
+};
@@ -0,0 +1,210 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <QString>
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <unordered_map>
+#include <vector>
+
+#include "keyed_list_model.h"
+
+// Case-insensitive substring index holding one text per key.
+// Every text is split into trigrams, a query intersects the posting lists
+// of its own trigrams and compares only the remaining candidates.
+// The matches of the last query are kept until the index changes.
+template <typename Key, typename Hash = ListModelKeyHash>
+class SubstringIndex
+{
+public:
+    void set(const Key& key, const QString& text)
+    {
+        remove(key);
+
+        const auto id = static_cast<DocId>(m_docs.size());
+        m_docs.push_back({ key, text.toCaseFolded(), true });
+        m_ids[key] = id;
+        addPostings(id);
+        m_resultValid = false;
+    }
+
+    void remove(const Key& key)
+    {
+        auto it = m_ids.find(key);
+        if (it == m_ids.end())
+        {
+            return;
+        }
+
+        // postings of a removed text are dropped on the next compaction
+        auto& doc = m_docs[it->second];
+        doc.alive = false;
+        doc.text.clear();
+        m_ids.erase(it);
+        m_resultValid = false;
+
+        if (++m_removed > kMinCompaction && m_removed > m_ids.size())
+        {
+            compact();
+        }
+    }
+
+    void clear()
+    {
+        m_docs.clear();
+        m_ids.clear();
+        m_postings.clear();
+        m_removed = 0;
+        m_resultValid = false;
+    }
+
+    size_t size() const
+    {
+        return m_ids.size();
+    }
+
+    bool matches(const Key& key, const QString& query) const
+    {
+        auto it = m_ids.find(key);
+        if (it == m_ids.end())
+        {
+            return false;
+        }
+
+        if (!m_resultValid || query != m_query)
+        {
+            find(query);
+        }
+        return m_result[it->second];
+    }
+
+private:
+    using DocId = uint32_t;
+    using Gram = uint64_t;
+
+    static constexpr int kGramSize = 3;
+    static constexpr size_t kMinCompaction = 1024;
+
+    struct Doc
+    {
+        Key key;
+        QString text;
+        bool alive;
+    };
+
+    static Gram gramAt(const QString& text, int pos)
+    {
+        return (Gram(text[pos].unicode()) << 32) | (Gram(text[pos + 1].unicode()) << 16) | Gram(text[pos + 2].unicode());
+    }
+
+    void addPostings(DocId id)
+    {
+        const auto& text = m_docs[id].text;
+        for (int pos = 0; pos + kGramSize <= text.size(); ++pos)
+        {
+            // ids only grow, so every posting list stays sorted
+            auto& list = m_postings[gramAt(text, pos)];
+            if (list.empty() || list.back() != id)
+            {
+                list.push_back(id);
+            }
+        }
+    }
+
+    void compact()
+    {
+        std::vector<Doc> docs;
+        docs.reserve(m_ids.size());
+        for (auto& doc : m_docs)
+        {
+            if (doc.alive)
+            {
+                docs.push_back(std::move(doc));
+            }
+        }
+
+        m_docs.swap(docs);
+        m_ids.clear();
+        m_postings.clear();
+        m_removed = 0;
+        for (DocId id = 0; id < m_docs.size(); ++id)
+        {
+            m_ids[m_docs[id].key] = id;
+            addPostings(id);
+        }
+    }
+
+    void find(const QString& query) const
+    {
+        m_query = query;
+        m_resultValid = true;
+        m_result.assign(m_docs.size(), false);
+
+        const auto folded = query.toCaseFolded();
+        if (folded.size() < kGramSize)
+        {
+            // too short to have a trigram, compare the folded texts directly
+            for (DocId id = 0; id < m_docs.size(); ++id)
+            {
+                m_result[id] = m_docs[id].alive && m_docs[id].text.contains(folded);
+            }
+            return;
+        }
+
+        std::vector<const std::vector<DocId>*> lists;
+        for (int pos = 0; pos + kGramSize <= folded.size(); ++pos)
+        {
+            auto it = m_postings.find(gramAt(folded, pos));
+            if (it == m_postings.end())
+            {
+                return;
+            }
+            lists.push_back(&it->second);
+        }
+
+        std::sort(lists.begin(), lists.end(), [](auto left, auto right)
+        {
+            return left->size() != right->size() ? left->size() < right->size() : left < right;
+        });
+        lists.erase(std::unique(lists.begin(), lists.end()), lists.end());
+
+        std::vector<DocId> candidates = *lists.front();
+        std::vector<DocId> common;
+        for (size_t i = 1; i < lists.size() && !candidates.empty(); ++i)
+        {
+            common.clear();
+            std::set_intersection(candidates.begin(), candidates.end(), lists[i]->begin(), lists[i]->end(), std::back_inserter(common));
+            candidates.swap(common);
+        }
+
+        // trigrams may come from different places of a text, confirm the whole query
+        for (auto id : candidates)
+        {
+            const auto& doc = m_docs[id];
+            m_result[id] = doc.alive && doc.text.contains(folded);
+        }
+    }
+
+    std::vector<Doc> m_docs;
+    std::unordered_map<Key, DocId, Hash> m_ids;
+    std::unordered_map<Gram, std::vector<DocId>> m_postings;
+    size_t m_removed = 0;
+
+    mutable QString m_query;
+    mutable bool m_resultValid = false;
+    mutable std::vector<bool> m_result;
+};
@@ -20,50 +20,14 @@
 
 TokenBootstrapManager::TokenBootstrapManager()
     : _wallet_model(AppModel::getInstance().getWalletModel())
+    , _txStore(AppModel::getInstance().getTxStore())
 {
-    connect(
-        _wallet_model,
-        SIGNAL(transactionsChanged(beam::wallet::ChangeAction,
-                        const std::vector<beam::wallet::TxDescription>&)),
-        SLOT(onTransactionsChanged(beam::wallet::ChangeAction,
-                        const std::vector<beam::wallet::TxDescription>&)));
-    _wallet_model->getAsync()->getTransactions();
+    // tokens checked before the history is loaded wait for it
+    connect(_txStore.get(), &TxStore::loaded, this, &TokenBootstrapManager::checkIsTxPreviousAccepted);
 }
 
 TokenBootstrapManager::~TokenBootstrapManager() {}
 
-void TokenBootstrapManager::onTransactionsChanged(
-    beam::wallet::ChangeAction action,
-    const std::vector<beam::wallet::TxDescription>& items)
-{
-    switch (action)
-    {
-    case beam::wallet::ChangeAction::Reset:
-        _myTxIds.clear(); // no break
-    case beam::wallet::ChangeAction::Added:
-    case beam::wallet::ChangeAction::Updated:
-        for (const auto& item : items)
-        {
-            if (const auto& id = item.GetTxID(); id)
-            {
-                _myTxIds.insert(*id);
-            }
-        }
-        break;
-    case beam::wallet::ChangeAction::Removed:
-        for (const auto& item : items)
-        {
-            if (const auto& id = item.GetTxID(); id)
-            {
-                _myTxIds.erase(*id);
-            }
-        }
-        break;
-    }
-
-    checkIsTxPreviousAccepted();
-}
-
 void TokenBootstrapManager::checkTokenForDuplicate(const QString& token)
 {
     auto parameters = beam::wallet::ParseParameters(token.toStdString());
@@ -91,29 +55,26 @@ void TokenBootstrapManager::checkTokenForDuplicate(const QString& token)
     auto txIdValue = txId.value();
     _tokensInProgress[txIdValue] = token;
 
-    _myTxIds.empty()
-        ? _wallet_model->getAsync()->getTransactions()
-        : checkIsTxPreviousAccepted();
+    if (_txStore->isLoaded())
+    {
+        checkIsTxPreviousAccepted();
+    }
 }
 
 void TokenBootstrapManager::checkIsTxPreviousAccepted()
 {
-    if (!_tokensInProgress.empty())
+    auto tokens = std::move(_tokensInProgress);
+    _tokensInProgress.clear();
+
+    for (const auto& [txId, token] : tokens)
     {
-        for (const auto& txId : _myTxIds)
+        if (_txStore->contains(txId))
         {
-            const auto& it = _tokensInProgress.find(txId);
-            if (it != _tokensInProgress.end())
-            {
-                emit tokenPreviousAccepted(it->second);
-                _tokensInProgress.erase(it);
-            }
+            emit tokenPreviousAccepted(token);
         }
-
-        for (const auto& token : _tokensInProgress)
+        else
         {
-            emit tokenFirstTimeAccepted(token.second);
+            emit tokenFirstTimeAccepted(token);
         }
-        _tokensInProgress.clear();
     }
 }
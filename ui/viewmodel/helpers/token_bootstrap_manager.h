@@ -14,6 +14,7 @@
 #pragma once
 
 #include "model/wallet_model.h"
+#include "model/tx_store.h"
 #include <map>
 #include <set>
 #include <QObject>
@@ -28,10 +29,6 @@ public:
 
     Q_INVOKABLE void checkTokenForDuplicate(const QString& token);
 
-public slots:
-    void onTransactionsChanged(beam::wallet::ChangeAction action,
-                    const std::vector<beam::wallet::TxDescription>& items);
-
 signals:   
     void tokenPreviousAccepted(const QString& token);
     void tokenFirstTimeAccepted(const QString& token);
@@ -41,6 +38,6 @@ private:
     void checkIsTxPreviousAccepted();
 
     WalletModel::Ptr _wallet_model;
+    TxStore::Ptr _txStore;
     std::map<beam::wallet::TxID, QString> _tokensInProgress;
-    std::set<beam::wallet::TxID> _myTxIds;
 };
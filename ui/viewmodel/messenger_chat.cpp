@@ -216,7 +216,8 @@ void MessengerChat::onMessages(const std::vector<beam::wallet::InstantMessage>&
             }
         }
     }
-    _messeges.reset(modifiedItems);
+    // keep the order the chat view was built for
+    _messeges.reset(modifiedItems.rbegin(), modifiedItems.rend());
     emit messagesChanged();
 
     if (!unreadMessages.empty())
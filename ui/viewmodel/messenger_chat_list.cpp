@@ -109,7 +109,8 @@ void MessengerChatList::onChatList(const std::vector<std::pair<beam::wallet::Wal
             name = it->m_label;
         modifiedItems.emplace_back(ChatItem{item.first, name, item.second});
     }
-    _chats.reset(modifiedItems);
+    // keep the order the chat list was built for
+    _chats.reset(modifiedItems.rbegin(), modifiedItems.rend());
     emit listChanged();
 }
 
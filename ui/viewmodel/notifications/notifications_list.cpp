@@ -87,6 +87,11 @@ QVariant NotificationsList::data(const QModelIndex &index, int role) const
     }
 }
 
+ECC::uintBig NotificationsList::keyOf(const std::shared_ptr<NotificationItem>& item) const
+{
+    return item->getID();
+}
+
 void NotificationsList::onAssetInfo(beam::Asset::ID assetId)
 {
     for (auto it = m_list.begin(); it != m_list.end(); ++it) {
@@ -15,11 +15,11 @@
 #pragma once
 
 #include "notification_item.h"
-#include "viewmodel/helpers/list_model.h"
+#include "viewmodel/helpers/keyed_list_model.h"
 #include "model/assets_manager.h"
 #include <QLocale>
 
-class NotificationsList : public ListModel<std::shared_ptr<NotificationItem>>
+class NotificationsList : public KeyedListModel<std::shared_ptr<NotificationItem>, ECC::uintBig>
 {
     Q_OBJECT
 
@@ -43,6 +43,9 @@ public:
     QVariant data(const QModelIndex &index, int role) const override;
     QHash<int, QByteArray> roleNames() const override;
 
+protected:
+    ECC::uintBig keyOf(const std::shared_ptr<NotificationItem>& item) const override;
+
 private:
     void onAssetInfo(beam::Asset::ID assetId);
 
@@ -108,7 +108,7 @@ void NotificationsViewModel::onNotificationsDataModelChanged(beam::wallet::Chang
     {
         case ChangeAction::Reset:
             {
-                m_notificationsList.reset(modifiedNotifications);
+                m_notificationsList.reset(std::move(modifiedNotifications));
                 break;
             }
 
@@ -19,14 +19,13 @@
 
 PushNotificationManager::PushNotificationManager()
     : m_walletModel(AppModel::getInstance().getWalletModel())
+    , m_txStore(AppModel::getInstance().getTxStore())
 {
     connect(m_walletModel,
             SIGNAL(notificationsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::Notification>&)),
             SLOT(onNotificationsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::Notification>&)));
 
-    connect(m_walletModel,
-            SIGNAL(transactionsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)),
-            SLOT(onTransactionsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)));
+    connect(m_txStore.get(), &TxStore::transactionsChanged, this, &PushNotificationManager::onTransactionsChanged);
 
     m_walletModel->getAsync()->getNotifications();
 }
@@ -47,6 +47,7 @@ public slots:
 
 private:
     WalletModel::Ptr m_walletModel;
+    TxStore::Ptr m_txStore;
     bool m_firstNotification = true;
     bool m_hasNewerVersion = false;
     std::set<beam::wallet::TxID> m_contractNotifications;
@@ -20,6 +20,7 @@
 #include "model/app_model.h"
 #include "model/helpers.h"
 #include "model/swap_coin_client_model.h"
+#include <algorithm>
 #include <thread>
 #include "wallet/core/secstring.h"
 #include "qml_globals.h"
@@ -679,6 +680,36 @@ void SettingsViewModel::setMinConfirmations(int value)
     m_settings.setMinConfirmations(value);
 }
 
+bool SettingsViewModel::getTxExportParallel() const
+{
+    return m_settings.getTxExportParallel();
+}
+
+void SettingsViewModel::setTxExportParallel(bool value)
+{
+    if (value != m_settings.getTxExportParallel())
+    {
+        m_settings.setTxExportParallel(value);
+        emit txExportSettingsChanged();
+    }
+}
+
+int SettingsViewModel::getTxExportCompressionLevel() const
+{
+    return m_settings.getTxExportCompressionLevel();
+}
+
+void SettingsViewModel::setTxExportCompressionLevel(int value)
+{
+    // -1 is the zlib default, 0 stores the files, 9 is the smallest archive
+    value = std::clamp(value, -1, 9);
+    if (value != m_settings.getTxExportCompressionLevel())
+    {
+        m_settings.setTxExportCompressionLevel(value);
+        emit txExportSettingsChanged();
+    }
+}
+
 QString SettingsViewModel::getExplorerUrl() const
 {
     return m_settings.getExplorerUrl();
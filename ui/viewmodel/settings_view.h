@@ -56,6 +56,8 @@ class SettingsViewModel : public QObject
     Q_PROPERTY(QString      faucetUrl                       READ getFaucetUrl                   CONSTANT)
     Q_PROPERTY(int          minConfirmations                READ getMinConfirmations            WRITE  setMinConfirmations NOTIFY minConfirmationsChanged)
     Q_PROPERTY(int          appsServerPort                  READ getAppsPort                    WRITE  setAppsPort     NOTIFY appsPortChanged)
+    Q_PROPERTY(bool         txExportParallel                READ getTxExportParallel            WRITE  setTxExportParallel NOTIFY txExportSettingsChanged)
+    Q_PROPERTY(int          txExportCompressionLevel        READ getTxExportCompressionLevel    WRITE  setTxExportCompressionLevel NOTIFY txExportSettingsChanged)
 
     Q_PROPERTY(bool ipfsSupported READ getIPFSSupported CONSTANT)
 
@@ -150,6 +152,11 @@ public:
     int getAppsPort() const;
     void setAppsPort(int port);
 
+    bool getTxExportParallel() const;
+    void setTxExportParallel(bool value);
+    int getTxExportCompressionLevel() const;
+    void setTxExportCompressionLevel(int value);
+
     QString getCurrentHeight() const;
 
     Q_INVOKABLE uint coreAmount() const;
@@ -207,6 +214,7 @@ signals:
     void minConfirmationsChanged();
     void stateChanged();
     void appsPortChanged();
+    void txExportSettingsChanged();
 
     #ifdef BEAM_IPFS_SUPPORT
     void IPFSSwarmPortChanged();
@@ -21,22 +21,50 @@ using namespace beam;
 using namespace std;
 using namespace beamui;
 
+namespace
+{
+    constexpr beam::Height kBlocksPerHour = 60;
+
+    uint64_t getCoinHash(const beam::wallet::Coin& coin)
+    {
+        ECC::Hash::Value hv;
+        coin.m_ID.get_Hash(hv);
+
+        return static_cast<uint64_t>(*reinterpret_cast<uint64_t*>(hv.m_pData));
+    }
+
+    uint64_t getShieldedCoinHash(const beam::wallet::ShieldedCoin& coin)
+    {
+        // maybe we don't need such a strong hashing here
+        ECC::Hash::Processor hp;
+        hp << coin.m_TxoID
+           << coin.m_CoinID.m_Value
+           << coin.m_CoinID.m_AssetID;
+        ECC::Hash::Value hv;
+        hp >> hv;
+        return static_cast<uint64_t>(*reinterpret_cast<uint64_t*>(hv.m_pData));
+    }
+}
+
+BaseUtxoItem::BaseUtxoItem(uint64_t hash)
+    : _hash(hash)
+{
+}
+
 bool BaseUtxoItem::operator==(const BaseUtxoItem& other) const
 {
     return getHash() == other.getHash();
 }
 
-UtxoItem::UtxoItem(beam::wallet::Coin coin)
-    : _coin(std::move(coin))
+uint64_t BaseUtxoItem::getHash() const
 {
+    return _hash;
 }
 
-uint64_t UtxoItem::getHash() const
+UtxoItem::UtxoItem(beam::wallet::Coin coin)
+    : BaseUtxoItem(getCoinHash(coin))
+    , _coin(std::move(coin))
 {
-    ECC::Hash::Value hv;
-    _coin.m_ID.get_Hash(hv);
-
-    return static_cast<uint64_t>(*reinterpret_cast<uint64_t*>(hv.m_pData));
 }
 
 QString UtxoItem::getAmount() const
@@ -121,12 +149,24 @@ uint16_t UtxoItem::rawMaturityTimeLeft() const
     if (walletModel->getCurrentHeight() < rawMaturity())
     {
         auto blocksLeft = rawMaturity() - walletModel->getCurrentHeight();
-        return blocksLeft / 60;
+        return blocksLeft / kBlocksPerHour;
     }
 
     return 0;
 }
 
+beam::Height UtxoItem::nextMaturityChange(beam::Height height) const
+{
+    if (!_coin.IsMaturityValid() || height >= rawMaturity())
+    {
+        return beam::MaxHeight;
+    }
+
+    // whole hours are shown, the value drops when the blocks left go below the next multiple of an hour
+    const auto hoursLeft = (rawMaturity() - height) / kBlocksPerHour;
+    return hoursLeft > 0 ? rawMaturity() - hoursLeft * kBlocksPerHour + 1 : beam::MaxHeight;
+}
+
 beam::Asset::ID UtxoItem::getAssetId() const
 {
     return _coin.m_ID.m_AssetID;
@@ -139,23 +179,12 @@ ShieldedCoinItem::ShieldedCoinItem()
 }
 
 ShieldedCoinItem::ShieldedCoinItem(beam::wallet::ShieldedCoin coin)
-    : _walletModel(AppModel::getInstance().getWalletModel())
+    : BaseUtxoItem(getShieldedCoinHash(coin))
+    , _walletModel(AppModel::getInstance().getWalletModel())
     , _coin(std::move(coin))
 {
 }
 
-uint64_t ShieldedCoinItem::getHash() const
-{
-    // maybe we don't need such a strong hashing here
-    ECC::Hash::Processor hp;
-    hp << _coin.m_TxoID
-       << _coin.m_CoinID.m_Value
-       << _coin.m_CoinID.m_AssetID;
-    ECC::Hash::Value hv;
-    hp >> hv;
-    return static_cast<uint64_t>(*reinterpret_cast<uint64_t*>(hv.m_pData));
-}
-
 QString ShieldedCoinItem::getAmount() const
 {
     return AmountToUIString(rawAmount());
@@ -223,6 +252,12 @@ uint16_t ShieldedCoinItem::rawMaturityTimeLeft() const
     return _walletModel->getMaturityHoursLeft(_coin);
 }
 
+beam::Height ShieldedCoinItem::nextMaturityChange(beam::Height height) const
+{
+    // the progress follows the shielded outputs added after the coin, it is read again every block
+    return _coin.m_Status == beam::wallet::ShieldedCoin::Maturing ? height + 1 : beam::MaxHeight;
+}
+
 beam::Asset::ID ShieldedCoinItem::getAssetId() const
 {
     return _coin.m_CoinID.m_AssetID;
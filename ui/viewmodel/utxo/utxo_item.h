@@ -25,7 +25,8 @@ public:
     BaseUtxoItem() = default;
     bool operator==(const BaseUtxoItem& other) const;
 
-    virtual uint64_t getHash() const = 0;
+    // identifies the coin in the lists, computed once when the item is made
+    uint64_t getHash() const;
     virtual QString getAmount() const = 0;
     virtual QString maturity() const = 0;
     virtual QString maturityPercentage() const = 0;
@@ -37,6 +38,14 @@ public:
     virtual beam::Amount rawAmount() const = 0;
     virtual beam::Height rawMaturity() const = 0;
     virtual uint16_t rawMaturityTimeLeft() const = 0;
+    // first height above |height| at which the maturity roles show something else, MaxHeight if none
+    virtual beam::Height nextMaturityChange(beam::Height height) const = 0;
+
+protected:
+    explicit BaseUtxoItem(uint64_t hash);
+
+private:
+    uint64_t _hash = 0;
 };
 
 class UtxoItem : public BaseUtxoItem
@@ -45,7 +54,6 @@ public:
 
     UtxoItem() = default;
     UtxoItem(beam::wallet::Coin coin);
-    uint64_t getHash() const override;
 
     QString getAmount() const override;
     QString maturity() const override;
@@ -58,6 +66,7 @@ public:
     beam::Amount rawAmount() const override;
     beam::Height rawMaturity() const override;
     uint16_t rawMaturityTimeLeft() const override;
+    beam::Height nextMaturityChange(beam::Height height) const override;
     const beam::wallet::Coin::ID& get_ID() const;
 private:
     beam::wallet::Coin _coin;
@@ -69,7 +78,6 @@ public:
 
     ShieldedCoinItem();
     ShieldedCoinItem(beam::wallet::ShieldedCoin coin);
-    uint64_t getHash() const override;
 
     QString getAmount() const override;
     QString maturity() const override;
@@ -82,6 +90,7 @@ public:
     beam::Amount rawAmount() const override;
     beam::Height rawMaturity() const override;
     uint16_t rawMaturityTimeLeft() const override;
+    beam::Height nextMaturityChange(beam::Height height) const override;
 private:
     WalletModel::Ptr _walletModel;
     beam::wallet::ShieldedCoin _coin;
@@ -16,10 +16,21 @@
 #include "viewmodel/ui_helpers.h"
 #include "model/app_model.h"
 
+namespace
+{
+    constexpr int kAssetInfoDelayMs = 100;
+}
+
 UtxoItemList::UtxoItemList()
     : _amgr(AppModel::getInstance().getAssets())
+    , _walletModel(AppModel::getInstance().getWalletModel())
+    , _height(_walletModel->getCurrentHeight())
 {
+    _assetInfoTimer.setSingleShot(true);
+    _assetInfoTimer.setInterval(kAssetInfoDelayMs);
+    connect(&_assetInfoTimer, &QTimer::timeout, this, &UtxoItemList::updateAssetRows);
     connect(_amgr.get(), &AssetsManager::assetInfo, this,  &UtxoItemList::onAssetInfo);
+    connect(_walletModel, &WalletModel::walletStatusChanged, this, &UtxoItemList::onWalletStatusChanged);
 }
 
 QHash<int, QByteArray> UtxoItemList::roleNames() const
@@ -87,17 +98,127 @@ auto UtxoItemList::data(const QModelIndex &index, int role) const -> QVariant
     }
 }
 
+uint64_t UtxoItemList::keyOf(const std::shared_ptr<BaseUtxoItem>& item) const
+{
+    return item->getHash();
+}
+
+void UtxoItemList::onItemAdded(const std::shared_ptr<BaseUtxoItem>& item)
+{
+    _assetRows.add(item->getAssetId(), keyOf(item));
+    scheduleMaturity(item);
+}
+
+void UtxoItemList::onItemRemoved(const std::shared_ptr<BaseUtxoItem>& item)
+{
+    _assetRows.remove(item->getAssetId(), keyOf(item));
+    _maturityScheduled.erase(keyOf(item));
+}
+
+void UtxoItemList::onItemsCleared()
+{
+    _assetRows.clear();
+    _maturityScheduled.clear();
+    _maturityQueue = {};
+}
+
 void UtxoItemList::onAssetInfo(beam::Asset::ID assetId)
 {
-    touch(assetId);
+    _changedAssets.insert(assetId);
+
+    // not restarted, a steady stream of asset info still gets shown
+    if (!_assetInfoTimer.isActive())
+    {
+        _assetInfoTimer.start();
+    }
 }
 
-void UtxoItemList::touch(beam::Asset::ID id)
+void UtxoItemList::updateAssetRows()
 {
-    for (auto it = m_list.begin(); it != m_list.end(); ++it) {
-        if ((*it)->getAssetId() == id) {
-           const auto idx = it - m_list.begin();
-           ListModel::touch(idx);
+    std::vector<int> rows;
+    for (auto assetId : _changedAssets)
+    {
+        _assetRows.collectRows(assetId, *this, rows);
+    }
+    _changedAssets.clear();
+    std::sort(rows.begin(), rows.end());
+
+    static const QVector<int> kAssetRoles =
+    {
+        static_cast<int>(Roles::UnitName),
+        static_cast<int>(Roles::IconSource),
+        static_cast<int>(Roles::Verified),
+    };
+    touchRanges(rows, kAssetRoles);
+}
+
+void UtxoItemList::scheduleMaturity(const std::shared_ptr<BaseUtxoItem>& item)
+{
+    const auto next = item->nextMaturityChange(_height);
+    if (next == beam::MaxHeight)
+    {
+        _maturityScheduled.erase(keyOf(item));
+        return;
+    }
+
+    _maturityScheduled[keyOf(item)] = next;
+    _maturityQueue.emplace(next, keyOf(item));
+}
+
+void UtxoItemList::onWalletStatusChanged()
+{
+    const auto height = _walletModel->getCurrentHeight();
+    if (height == _height)
+    {
+        return;
+    }
+
+    static const QVector<int> kMaturityRoles =
+    {
+        static_cast<int>(Roles::MaturityPercentage),
+        static_cast<int>(Roles::MaturityPercentageSort),
+        static_cast<int>(Roles::MaturityTimeLeft),
+        static_cast<int>(Roles::MaturityTimeLeftSort),
+    };
+
+    if (height < _height)
+    {
+        // rollback, the schedule only goes forward
+        _height = height;
+        _maturityScheduled.clear();
+        _maturityQueue = {};
+        for (const auto& item : m_list)
+        {
+            scheduleMaturity(item);
+        }
+        touch(0, rowCount() - 1, kMaturityRoles);
+        return;
+    }
+
+    _height = height;
+
+    std::vector<int> rows;
+    while (!_maturityQueue.empty() && _maturityQueue.top().first <= height)
+    {
+        const auto [at, key] = _maturityQueue.top();
+        _maturityQueue.pop();
+
+        auto it = _maturityScheduled.find(key);
+        if (it == _maturityScheduled.end() || it->second != at)
+        {
+            continue;
+        }
+
+        const auto row = indexOf(key);
+        if (row < 0)
+        {
+            continue;
         }
+
+        rows.push_back(row);
+        scheduleMaturity(m_list[row]);
     }
+
+    std::sort(rows.begin(), rows.end());
+    touchRanges(rows, kMaturityRoles);
 }
@@ -15,10 +15,16 @@
 #pragma once
 
 #include "utxo_item.h"
-#include "viewmodel/helpers/list_model.h"
+#include "viewmodel/helpers/keyed_list_model.h"
+#include "viewmodel/helpers/asset_rows_index.h"
 #include "model/assets_manager.h"
+#include <QTimer>
+#include <functional>
+#include <queue>
+#include <set>
+#include <unordered_map>
 
-class UtxoItemList : public ListModel<std::shared_ptr<BaseUtxoItem>>
+class UtxoItemList : public KeyedListModel<std::shared_ptr<BaseUtxoItem>, uint64_t>
 {
     Q_OBJECT
 public:
@@ -48,7 +54,31 @@ public:
 public slots:
     void onAssetInfo(beam::Asset::ID assetId);
 
+protected:
+    uint64_t keyOf(const std::shared_ptr<BaseUtxoItem>& item) const override;
+    void onItemAdded(const std::shared_ptr<BaseUtxoItem>& item) override;
+    void onItemRemoved(const std::shared_ptr<BaseUtxoItem>& item) override;
+    void onItemsCleared() override;
+
+private slots:
+    void updateAssetRows();
+    void onWalletStatusChanged();
+
 private:
-    void touch(beam::Asset::ID id);
+    void scheduleMaturity(const std::shared_ptr<BaseUtxoItem>& item);
+
     AssetsManager::Ptr _amgr;
+    WalletModel::Ptr _walletModel;
+    AssetRowsIndex<uint64_t> _assetRows;
+
+    // asset info arrives in bursts, rows are updated once per burst
+    std::set<beam::Asset::ID> _changedAssets;
+    QTimer _assetInfoTimer;
+
+    // coins ordered by the next height their maturity roles change at. Entries of
+    // rescheduled and removed coins are left in the heap and skipped when they come up
+    using MaturityEntry = std::pair<beam::Height, uint64_t>;
+    std::priority_queue<MaturityEntry, std::vector<MaturityEntry>, std::greater<MaturityEntry>> _maturityQueue;
+    std::unordered_map<uint64_t, beam::Height> _maturityScheduled;
+    beam::Height _height = 0;
 };
@@ -15,6 +15,7 @@
 #include "utxo_view.h"
 #include "viewmodel/ui_helpers.h"
 #include "model/app_model.h"
+#include "viewmodel/helpers/row_pool.h"
 using namespace beam;
 using namespace std;
 using namespace beamui;
@@ -30,7 +31,7 @@ UtxoViewModel::UtxoViewModel()
 
 QAbstractItemModel* UtxoViewModel::getAllUtxos()
 {
-    return &m_allUtxos;
+    return m_assetId ? &m_partitions[*m_assetId].list : &m_allUtxos.list;
 }
 
 QString UtxoViewModel::getCurrentHeight() const
@@ -66,9 +67,14 @@ void UtxoViewModel::setAssetId(unsigned int id)
 {
     if (!m_assetId || (*m_assetId != id))
     {
+        if (!m_assetId)
+        {
+            splitByAsset();
+        }
+
         m_assetId = id;
         emit assetIdChanged();
-        m_model->getAsync()->getAllUtxosStatus();
+        emit allUtxoChanged();
     }
 }
 
@@ -79,45 +85,108 @@ void UtxoViewModel::onNormalCoinsChanged(beam::wallet::ChangeAction action, cons
     if (getMaturingMaxPrivacy())
         return;
 
-    vector<shared_ptr<BaseUtxoItem>> modifiedItems;
+    if (action == ChangeAction::Reset)
+    {
+        RowPool<UtxoItem>::nextGeneration();
+    }
+
+    Items modifiedItems;
     modifiedItems.reserve(utxos.size());
 
     for (const auto& t : utxos)
     {
-        if (m_assetId)
+        modifiedItems.push_back(RowPool<UtxoItem>::make(t));
+    }
+
+    apply(action, false, std::move(modifiedItems), {});
+    emit allUtxoChanged();
+}
+
+void UtxoViewModel::onShieldedCoinChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::ShieldedCoin>& items)
+{
+    using namespace beam::wallet;
+
+    if (action == ChangeAction::Reset)
+    {
+        RowPool<ShieldedCoinItem>::nextGeneration();
+    }
+
+    Items modifiedItems;
+    Items droppedItems;
+    modifiedItems.reserve(items.size());
+
+    for (const auto& t : items)
+    {
+        // a coin which is no longer maturing leaves the max privacy list
+        auto& target = getMaturingMaxPrivacy() && t.m_Status != beam::wallet::ShieldedCoin::Status::Maturing
+            ? droppedItems
+            : modifiedItems;
+        target.push_back(RowPool<ShieldedCoinItem>::make(t));
+    }
+
+    apply(action, true, std::move(modifiedItems), std::move(droppedItems));
+    emit allUtxoChanged();
+}
+
+void UtxoViewModel::apply(beam::wallet::ChangeAction action, bool shielded, Items&& items, Items&& dropped)
+{
+    using namespace beam::wallet;
+
+    if (!m_assetId)
+    {
+        apply(m_allUtxos, action, shielded, std::move(items), dropped);
+        return;
+    }
+
+    std::map<beam::Asset::ID, std::pair<Items, Items>> byAsset;
+    if (action == ChangeAction::Reset)
+    {
+        // assets which have no coins of this type anymore are reset too
+        for (const auto& [assetId, partition] : m_partitions)
         {
-            if (t.m_ID.m_AssetID != *m_assetId)
-            {
-                continue;
-            }
+            byAsset[assetId];
         }
+    }
 
-        modifiedItems.push_back(make_shared<UtxoItem>(t));
+    for (auto& item : items)
+    {
+        byAsset[item->getAssetId()].first.push_back(std::move(item));
+    }
+
+    for (auto& item : dropped)
+    {
+        byAsset[item->getAssetId()].second.push_back(std::move(item));
     }
 
+    for (auto& [assetId, changes] : byAsset)
+    {
+        apply(m_partitions[assetId], action, shielded, std::move(changes.first), changes.second);
+    }
+}
+
+void UtxoViewModel::apply(Partition& partition, beam::wallet::ChangeAction action, bool shielded, Items&& items, const Items& dropped)
+{
+    using namespace beam::wallet;
+
     switch (action)
     {
     case ChangeAction::Reset:
     {
-        m_allUtxos.reset(modifiedItems);
+        partition.reset(shielded, std::move(items));
         break;
     }
 
     case ChangeAction::Removed:
     {
-        m_allUtxos.remove(modifiedItems);
+        partition.remove(items);
         break;
     }
 
     case ChangeAction::Added:
-    {
-        m_allUtxos.insert(modifiedItems);
-        break;
-    }
-
     case ChangeAction::Updated:
     {
-        m_allUtxos.update(modifiedItems);
+        partition.remove(dropped);
+        partition.update(items);
         break;
     }
 
@@ -125,76 +194,82 @@ void UtxoViewModel::onNormalCoinsChanged(beam::wallet::ChangeAction action, cons
         assert(false && "Unexpected action");
         break;
     }
-
-    emit allUtxoChanged();
 }
 
-void UtxoViewModel::onShieldedCoinChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::ShieldedCoin>& items)
+// the first asset selection sorts the coins loaded so far into per asset partitions
+void UtxoViewModel::splitByAsset()
 {
-    using namespace beam::wallet;
-
-    vector<shared_ptr<BaseUtxoItem>> modifiedItems;
-    modifiedItems.reserve(items.size());
+    std::map<beam::Asset::ID, Items> byAsset;
+    for (const auto& item : m_allUtxos.list)
+    {
+        byAsset[item->getAssetId()].push_back(item);
+    }
+    m_allUtxos.clear();
 
-    for (const auto& t : items)
+    for (auto& [assetId, items] : byAsset)
     {
-        if (m_assetId)
-        {
-            if (t.m_CoinID.m_AssetID != *m_assetId)
-            {
-                continue;
-            }
-        }
+        m_partitions[assetId].update(items);
+    }
+}
 
-        if (getMaturingMaxPrivacy() && t.m_Status != beam::wallet::ShieldedCoin::Status::Maturing)
+void UtxoViewModel::Partition::reset(bool shielded, Items&& items)
+{
+    auto& keys = shielded ? shieldedKeys : normalKeys;
+    const auto& otherKeys = shielded ? normalKeys : shieldedKeys;
+
+    if (otherKeys.empty())
+    {
+        keys.clear();
+        for (const auto& item : items)
         {
-            continue;
+            keys.insert(item->getHash());
         }
-
-        modifiedItems.push_back(make_shared<ShieldedCoinItem>(t));
+        list.reset(std::move(items));
+        return;
     }
 
-    switch (action)
+    // only the rows of this coin type are replaced
+    Items old;
+    old.reserve(keys.size());
+    for (auto key : keys)
     {
-    case ChangeAction::Reset:
-    {
-        // temporary hack
-        vector<shared_ptr<BaseUtxoItem>> toRemove;
-        for (const auto& item : m_allUtxos)
+        if (auto row = list.indexOf(key); row >= 0)
         {
-            if (item->type() == UtxoViewType::EnType::Shielded)
-            {
-                toRemove.push_back(item);
-            }
+            old.push_back(list.get(row));
         }
-        m_allUtxos.remove(toRemove);
-        m_allUtxos.insert(modifiedItems);
-        break;
     }
+    remove(old);
+    update(items);
+}
 
-    case ChangeAction::Removed:
+void UtxoViewModel::Partition::update(const Items& items)
+{
+    for (const auto& item : items)
     {
-        m_allUtxos.remove(modifiedItems);
-        break;
+        auto& keys = item->type() == UtxoViewType::Shielded ? shieldedKeys : normalKeys;
+        keys.insert(item->getHash());
     }
+    list.update(items);
+}
 
-    case ChangeAction::Added:
+void UtxoViewModel::Partition::remove(const Items& items)
+{
+    if (items.empty())
     {
-        m_allUtxos.insert(modifiedItems);
-        break;
+        return;
     }
 
-    case ChangeAction::Updated:
+    for (const auto& item : items)
     {
-        m_allUtxos.update(modifiedItems);
-        break;
+        normalKeys.erase(item->getHash());
+        shieldedKeys.erase(item->getHash());
     }
-
-    default:
-        assert(false && "Unexpected action");
-        break;
-    }
-
-    emit allUtxoChanged();
+    list.remove(items);
 }
 
+void UtxoViewModel::Partition::clear()
+{
+    normalKeys.clear();
+    shieldedKeys.clear();
+    list.reset(Items());
+}
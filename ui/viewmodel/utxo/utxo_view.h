@@ -15,6 +15,8 @@
 #pragma once
 
 #include <QObject>
+#include <map>
+#include <unordered_set>
 #include "model/wallet_model.h"
 #include "utxo_item_list.h"
 
@@ -50,8 +52,31 @@ signals:
     void assetIdChanged();
 
 private:
-    UtxoItemList     m_allUtxos;
+    using Items = std::vector<std::shared_ptr<BaseUtxoItem>>;
+
+    // coins of one asset (or of all of them), regular and shielded coins are reset separately
+    struct Partition
+    {
+        void reset(bool shielded, Items&& items);
+        void update(const Items& items);
+        void remove(const Items& items);
+        void clear();
+
+        UtxoItemList list;
+        std::unordered_set<uint64_t> normalKeys;
+        std::unordered_set<uint64_t> shieldedKeys;
+    };
+
+    void apply(beam::wallet::ChangeAction action, bool shielded, Items&& items, Items&& dropped);
+    void apply(Partition& partition, beam::wallet::ChangeAction action, bool shielded, Items&& items, const Items& dropped);
+    void splitByAsset();
+
     WalletModel::Ptr m_model;
     bool             m_maturingMaxPrivacy = false;
     boost::optional<beam::Asset::ID> m_assetId;
+
+    // coins are kept for every asset, selecting an asset only switches the list shown.
+    // Until an asset is selected all coins go to |m_allUtxos|
+    Partition m_allUtxos;
+    std::map<beam::Asset::ID, Partition> m_partitions;
 };
@@ -0,0 +1,635 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "tx_filter_model.h"
+#include <algorithm>
+
+namespace
+{
+    // true if any of the changed |roles| is built from the values the criteria look at,
+    // an empty list means the whole row has changed
+    bool isFilterRole(const QVector<int>& roles)
+    {
+        if (roles.isEmpty())
+        {
+            return true;
+        }
+
+        using Roles = TxObjectList::Roles;
+        return std::any_of(roles.begin(), roles.end(), [](int role)
+        {
+            switch (static_cast<Roles>(role))
+            {
+            case Roles::FilterStatus:
+            case Roles::Status:
+            case Roles::IsDexTx:
+            case Roles::IsDappTx:
+            case Roles::DAppId:
+            case Roles::AssetFilter:
+            case Roles::AssetIDs:
+            case Roles::Search:
+            case Roles::TxID:
+            case Roles::KernelID:
+            case Roles::AddressFrom:
+            case Roles::AddressTo:
+            case Roles::Comment:
+            case Roles::Token:
+                return true;
+            default:
+                return false;
+            }
+        });
+    }
+}
+
+const QString TxFilterModel::kAllDapps = "all";
+
+TxFilterModel::TxFilterModel(TxObjectList& source, QObject* parent)
+    : QAbstractProxyModel(parent)
+    , _source(source)
+{
+    _statusVisible.fill(true);
+    // the status filters never matched a transaction without a known status, keep hiding them
+    _statusVisible[static_cast<size_t>(TxFilterStatus::Unknown)] = false;
+
+    QAbstractProxyModel::setSourceModel(&_source);
+    connect(&_source, &QAbstractItemModel::rowsInserted, this, &TxFilterModel::onSourceRowsInserted);
+    connect(&_source, &QAbstractItemModel::rowsAboutToBeRemoved, this, &TxFilterModel::onSourceRowsAboutToBeRemoved);
+    connect(&_source, &QAbstractItemModel::rowsRemoved, this, &TxFilterModel::onSourceRowsRemoved);
+    connect(&_source, &QAbstractItemModel::dataChanged, this, &TxFilterModel::onSourceDataChanged);
+    connect(&_source, &QAbstractItemModel::modelAboutToBeReset, this, &TxFilterModel::onSourceAboutToBeReset);
+    connect(&_source, &QAbstractItemModel::modelReset, this, &TxFilterModel::onSourceReset);
+    connect(&_source, &QAbstractItemModel::layoutAboutToBeChanged, this, &TxFilterModel::onSourceAboutToBeReset);
+    connect(&_source, &QAbstractItemModel::layoutChanged, this, &TxFilterModel::onSourceReset);
+
+    connect(this, &QAbstractItemModel::rowsInserted, this, &TxFilterModel::countChanged);
+    connect(this, &QAbstractItemModel::rowsRemoved, this, &TxFilterModel::countChanged);
+    connect(this, &QAbstractItemModel::modelReset, this, &TxFilterModel::countChanged);
+
+    rebuild();
+}
+
+QModelIndex TxFilterModel::index(int row, int column, const QModelIndex& parent) const
+{
+    if (parent.isValid() || column != 0 || row < 0 || row >= rowCount())
+    {
+        return QModelIndex();
+    }
+    return createIndex(row, column);
+}
+
+QModelIndex TxFilterModel::parent(const QModelIndex&) const
+{
+    return QModelIndex();
+}
+
+int TxFilterModel::rowCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : static_cast<int>(_rows.size());
+}
+
+int TxFilterModel::columnCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : 1;
+}
+
+QModelIndex TxFilterModel::mapToSource(const QModelIndex& proxyIndex) const
+{
+    if (!proxyIndex.isValid() || proxyIndex.row() >= rowCount())
+    {
+        return QModelIndex();
+    }
+    return _source.index(_rows[proxyIndex.row()]);
+}
+
+QModelIndex TxFilterModel::mapFromSource(const QModelIndex& sourceIndex) const
+{
+    if (!sourceIndex.isValid() || sourceIndex.row() >= static_cast<int>(_proxyRows.size()))
+    {
+        return QModelIndex();
+    }
+
+    const int row = _proxyRows[sourceIndex.row()];
+    return row >= 0 ? createIndex(row, 0) : QModelIndex();
+}
+
+QHash<int, QByteArray> TxFilterModel::roleNames() const
+{
+    return _source.roleNames();
+}
+
+bool TxFilterModel::matchesRow(int row, int role, const QString& text, bool& matches) const
+{
+    return row >= 0 && row < rowCount() && _source.matchesRow(_rows[row], role, text, matches);
+}
+
+bool TxFilterModel::isStatusVisible(TxFilterStatus status) const
+{
+    return _statusVisible[static_cast<size_t>(status)];
+}
+
+void TxFilterModel::setStatusVisible(TxFilterStatus status, bool visible)
+{
+    const auto group = static_cast<size_t>(status);
+    if (_statusVisible[group] == visible)
+    {
+        return;
+    }
+
+    _statusVisible[group] = visible;
+
+    // only the rows of the toggled group can change their state
+    std::vector<int> changed;
+    for (int row : _statusRows[group])
+    {
+        if ((_proxyRows[row] >= 0) != acceptsRow(row))
+        {
+            changed.push_back(row);
+        }
+    }
+
+    if (visible)
+    {
+        acceptRows(changed);
+    }
+    else
+    {
+        rejectRows(changed);
+    }
+}
+
+const std::vector<beam::Asset::ID>& TxFilterModel::getAssets() const
+{
+    return _assets;
+}
+
+void TxFilterModel::setAssets(std::vector<beam::Asset::ID> assets)
+{
+    std::sort(assets.begin(), assets.end());
+    assets.erase(std::unique(assets.begin(), assets.end()), assets.end());
+    if (assets == _assets)
+    {
+        return;
+    }
+
+    // an empty list accepts everything, otherwise fewer assets accept fewer transactions
+    Scope scope = Scope::All;
+    if (_assets.empty())
+    {
+        scope = Scope::Accepted;
+    }
+    else if (assets.empty() || std::includes(assets.begin(), assets.end(), _assets.begin(), _assets.end()))
+    {
+        scope = Scope::Rejected;
+    }
+    else if (std::includes(_assets.begin(), _assets.end(), assets.begin(), assets.end()))
+    {
+        scope = Scope::Accepted;
+    }
+
+    _assets = std::move(assets);
+    refilter(scope);
+}
+
+bool TxFilterModel::getDexOnly() const
+{
+    return _dexOnly;
+}
+
+void TxFilterModel::setDexOnly(bool value)
+{
+    if (_dexOnly == value)
+    {
+        return;
+    }
+
+    _dexOnly = value;
+    refilter(value ? Scope::Accepted : Scope::Rejected);
+}
+
+const QString& TxFilterModel::getDappFilter() const
+{
+    return _dappFilter;
+}
+
+void TxFilterModel::setDappFilter(const QString& value)
+{
+    if (_dappFilter == value)
+    {
+        return;
+    }
+
+    // no filter > any DApp > one DApp
+    auto rank = [](const QString& filter)
+    {
+        return filter.isEmpty() ? 0 : (filter == kAllDapps ? 1 : 2);
+    };
+
+    const int oldRank = rank(_dappFilter);
+    const int newRank = rank(value);
+
+    _dappFilter = value;
+    refilter(newRank == oldRank ? Scope::All : (newRank > oldRank ? Scope::Accepted : Scope::Rejected));
+}
+
+const QString& TxFilterModel::getSearchText() const
+{
+    return _searchText;
+}
+
+void TxFilterModel::setSearchText(const QString& value)
+{
+    if (_searchText == value)
+    {
+        return;
+    }
+
+    // typing more characters only drops rows, erasing them only brings rows back
+    Scope scope = Scope::All;
+    if (value.contains(_searchText, Qt::CaseInsensitive))
+    {
+        scope = Scope::Accepted;
+    }
+    else if (_searchText.contains(value, Qt::CaseInsensitive))
+    {
+        scope = Scope::Rejected;
+    }
+
+    _searchText = value;
+    refilter(scope);
+}
+
+// cheapest checks go first, the search text is looked up last
+bool TxFilterModel::acceptsRow(int sourceRow) const
+{
+    const auto& columns = _columns[sourceRow];
+
+    if (!_statusVisible[static_cast<size_t>(columns.status)])
+    {
+        return false;
+    }
+
+    if (_dexOnly && !columns.isDex)
+    {
+        return false;
+    }
+
+    if (!_dappFilter.isEmpty())
+    {
+        if (!columns.isDapp)
+        {
+            return false;
+        }
+
+        if (_dappFilter != kAllDapps && columns.appId.compare(_dappFilter, Qt::CaseInsensitive) != 0)
+        {
+            return false;
+        }
+    }
+
+    if (!_assets.empty())
+    {
+        auto found = std::any_of(columns.assets.begin(), columns.assets.end(), [this](beam::Asset::ID assetId)
+        {
+            return std::binary_search(_assets.begin(), _assets.end(), assetId);
+        });
+
+        if (!found)
+        {
+            return false;
+        }
+    }
+
+    return _searchText.isEmpty() || matchesText(sourceRow);
+}
+
+bool TxFilterModel::matchesText(int sourceRow) const
+{
+    const int role = static_cast<int>(TxObjectList::Roles::Search);
+
+    bool matches = false;
+    if (_source.matchesRow(sourceRow, role, _searchText, matches))
+    {
+        return matches;
+    }
+
+    return _source.data(_source.index(sourceRow), role).toString().contains(_searchText, Qt::CaseInsensitive);
+}
+
+void TxFilterModel::refilter(Scope scope)
+{
+    std::vector<int> rejected;
+    if (scope != Scope::Rejected)
+    {
+        for (int row : _rows)
+        {
+            if (!acceptsRow(row))
+            {
+                rejected.push_back(row);
+            }
+        }
+    }
+
+    // rows of hidden status groups stay rejected whatever the other criteria are
+    std::vector<int> accepted;
+    if (scope != Scope::Accepted)
+    {
+        for (size_t group = 0; group < kStatusCount; ++group)
+        {
+            if (!_statusVisible[group])
+            {
+                continue;
+            }
+
+            for (int row : _statusRows[group])
+            {
+                if (_proxyRows[row] < 0 && acceptsRow(row))
+                {
+                    accepted.push_back(row);
+                }
+            }
+        }
+    }
+
+    rejectRows(rejected);
+    acceptRows(accepted);
+}
+
+void TxFilterModel::acceptRows(const std::vector<int>& sourceRows)
+{
+    if (sourceRows.empty())
+    {
+        return;
+    }
+
+    const int first = rowCount();
+    beginInsertRows(QModelIndex(), first, first + static_cast<int>(sourceRows.size()) - 1);
+    for (int row : sourceRows)
+    {
+        _proxyRows[row] = static_cast<int>(_rows.size());
+        _rows.push_back(row);
+    }
+    endInsertRows();
+}
+
+void TxFilterModel::rejectRows(const std::vector<int>& sourceRows)
+{
+    if (sourceRows.empty())
+    {
+        return;
+    }
+
+    std::vector<int> holes;
+    holes.reserve(sourceRows.size());
+    for (int row : sourceRows)
+    {
+        holes.push_back(_proxyRows[row]);
+        _proxyRows[row] = -1;
+    }
+    std::sort(holes.begin(), holes.end());
+
+    // the rejected rows below the tail are refilled with the accepted tail rows
+    const int count = rowCount();
+    const int tail = count - static_cast<int>(holes.size());
+    std::vector<int> moved;
+    auto hole = holes.begin();
+    for (int row = tail; row < count && hole != holes.end() && *hole < tail; ++row)
+    {
+        const int sourceRow = _rows[row];
+        if (_proxyRows[sourceRow] < 0)
+        {
+            continue;
+        }
+
+        _rows[*hole] = sourceRow;
+        _proxyRows[sourceRow] = *hole;
+        moved.push_back(*hole);
+        ++hole;
+    }
+
+    touchRows(std::move(moved));
+
+    beginRemoveRows(QModelIndex(), tail, count - 1);
+    _rows.resize(tail);
+    endRemoveRows();
+}
+
+void TxFilterModel::touchRows(std::vector<int> proxyRows, const QVector<int>& roles)
+{
+    std::sort(proxyRows.begin(), proxyRows.end());
+
+    auto it = proxyRows.begin();
+    while (it != proxyRows.end())
+    {
+        const int first = *it;
+        int last = first;
+        while (++it != proxyRows.end() && *it == last + 1)
+        {
+            last = *it;
+        }
+        emit dataChanged(index(first, 0), index(last, 0), roles);
+    }
+}
+
+void TxFilterModel::trackRow(int sourceRow)
+{
+    const auto tx = _source.get(sourceRow);
+    auto& columns = _columns[sourceRow];
+
+    columns.status = tx->getFilterStatus();
+    columns.isDex = tx->isDexTx();
+    columns.isDapp = tx->isDappTx();
+    columns.appId = columns.isDapp ? tx->getAppId() : QString();
+    columns.assets = tx->getAssetsList();
+
+    auto& rows = _statusRows[static_cast<size_t>(columns.status)];
+    _rowStatusPos[sourceRow] = static_cast<int>(rows.size());
+    rows.push_back(sourceRow);
+}
+
+void TxFilterModel::untrackRow(int sourceRow)
+{
+    auto& rows = _statusRows[static_cast<size_t>(_columns[sourceRow].status)];
+    const int pos = _rowStatusPos[sourceRow];
+
+    rows[pos] = rows.back();
+    _rowStatusPos[rows[pos]] = pos;
+    rows.pop_back();
+}
+
+// source rows at and after |from| moved by |delta|, only needed when the source does not append
+void TxFilterModel::shiftRows(int from, int delta)
+{
+    auto shift = [from, delta](int& row)
+    {
+        if (row >= from)
+        {
+            row += delta;
+        }
+    };
+
+    std::for_each(_rows.begin(), _rows.end(), shift);
+    for (auto& rows : _statusRows)
+    {
+        std::for_each(rows.begin(), rows.end(), shift);
+    }
+}
+
+void TxFilterModel::rebuild()
+{
+    const auto count = static_cast<size_t>(_source.rowCount());
+
+    for (auto& rows : _statusRows)
+    {
+        rows.clear();
+    }
+    _columns.assign(count, Columns());
+    _rowStatusPos.assign(count, -1);
+    _proxyRows.assign(count, -1);
+    _rows.clear();
+
+    for (int row = 0; row < static_cast<int>(count); ++row)
+    {
+        trackRow(row);
+        if (acceptsRow(row))
+        {
+            _proxyRows[row] = static_cast<int>(_rows.size());
+            _rows.push_back(row);
+        }
+    }
+}
+
+void TxFilterModel::onSourceRowsInserted(const QModelIndex& parent, int first, int last)
+{
+    if (parent.isValid())
+    {
+        return;
+    }
+
+    const int count = last - first + 1;
+    if (first < static_cast<int>(_proxyRows.size()))
+    {
+        shiftRows(first, count);
+    }
+
+    _columns.insert(_columns.begin() + first, count, Columns());
+    _rowStatusPos.insert(_rowStatusPos.begin() + first, count, -1);
+    _proxyRows.insert(_proxyRows.begin() + first, count, -1);
+
+    std::vector<int> accepted;
+    for (int row = first; row <= last; ++row)
+    {
+        trackRow(row);
+        if (acceptsRow(row))
+        {
+            accepted.push_back(row);
+        }
+    }
+    acceptRows(accepted);
+}
+
+void TxFilterModel::onSourceRowsAboutToBeRemoved(const QModelIndex& parent, int first, int last)
+{
+    if (parent.isValid())
+    {
+        return;
+    }
+
+    std::vector<int> rejected;
+    for (int row = first; row <= last; ++row)
+    {
+        untrackRow(row);
+        if (_proxyRows[row] >= 0)
+        {
+            rejected.push_back(row);
+        }
+    }
+    rejectRows(rejected);
+}
+
+void TxFilterModel::onSourceRowsRemoved(const QModelIndex& parent, int first, int last)
+{
+    if (parent.isValid())
+    {
+        return;
+    }
+
+    _columns.erase(_columns.begin() + first, _columns.begin() + last + 1);
+    _rowStatusPos.erase(_rowStatusPos.begin() + first, _rowStatusPos.begin() + last + 1);
+    _proxyRows.erase(_proxyRows.begin() + first, _proxyRows.begin() + last + 1);
+
+    if (first < static_cast<int>(_proxyRows.size()))
+    {
+        shiftRows(last + 1, first - last - 1);
+    }
+}
+
+void TxFilterModel::onSourceDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight, const QVector<int>& roles)
+{
+    std::vector<int> changed;
+
+    // amounts, rates or asset looks changed, the rows keep their place
+    if (!isFilterRole(roles))
+    {
+        for (int row = topLeft.row(); row <= bottomRight.row(); ++row)
+        {
+            if (_proxyRows[row] >= 0)
+            {
+                changed.push_back(_proxyRows[row]);
+            }
+        }
+
+        touchRows(std::move(changed), roles);
+        return;
+    }
+
+    std::vector<int> accepted;
+    std::vector<int> rejected;
+
+    for (int row = topLeft.row(); row <= bottomRight.row(); ++row)
+    {
+        // an updated transaction may have moved to another status group
+        untrackRow(row);
+        trackRow(row);
+
+        const bool wasAccepted = _proxyRows[row] >= 0;
+        const bool isAccepted = acceptsRow(row);
+        if (wasAccepted && isAccepted)
+        {
+            changed.push_back(_proxyRows[row]);
+        }
+        else if (isAccepted)
+        {
+            accepted.push_back(row);
+        }
+        else if (wasAccepted)
+        {
+            rejected.push_back(row);
+        }
+    }
+
+    touchRows(std::move(changed), roles);
+    rejectRows(rejected);
+    acceptRows(accepted);
+}
+
+void TxFilterModel::onSourceAboutToBeReset()
+{
+    beginResetModel();
+}
+
+void TxFilterModel::onSourceReset()
+{
+    rebuild();
+    endResetModel();
+}
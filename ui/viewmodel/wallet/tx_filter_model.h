@@ -0,0 +1,125 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QAbstractProxyModel>
+#include <array>
+#include <vector>
+#include "tx_object_list.h"
+#include "viewmodel/helpers/searchable_model.h"
+
+// Flat proxy over TxObjectList showing the transactions accepted by all the criteria of the
+// transactions view: status groups, assets, source (DEX or DApps), DApp id and search text.
+// The criteria are evaluated in C++ over columns captured once per source row, cheapest first
+// with early exit, and a criteria change re-evaluates only the rows it can affect:
+// showing or hiding a status touches only that status group, narrowing a criterion
+// re-checks only the accepted rows, widening it only the rejected ones.
+// Source data changes keep their roles, a change of roles no criterion looks at is not re-checked.
+// Accepted rows are not kept in source order, a rejected row is replaced by the last one,
+// views sort through SortFilterProxyModel.
+class TxFilterModel : public QAbstractProxyModel, public SearchableModel
+{
+    Q_OBJECT
+    Q_PROPERTY(int count READ rowCount NOTIFY countChanged)
+public:
+    // DApp filter value accepting transactions of any DApp
+    static const QString kAllDapps;
+
+    explicit TxFilterModel(TxObjectList& source, QObject* parent = nullptr);
+
+    [[nodiscard]] QModelIndex index(int row, int column, const QModelIndex& parent = QModelIndex()) const override;
+    [[nodiscard]] QModelIndex parent(const QModelIndex& child) const override;
+    [[nodiscard]] int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    [[nodiscard]] int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+    [[nodiscard]] QModelIndex mapToSource(const QModelIndex& proxyIndex) const override;
+    [[nodiscard]] QModelIndex mapFromSource(const QModelIndex& sourceIndex) const override;
+    [[nodiscard]] QHash<int, QByteArray> roleNames() const override;
+
+    bool matchesRow(int row, int role, const QString& text, bool& matches) const override;
+
+    [[nodiscard]] bool isStatusVisible(TxFilterStatus status) const;
+    void setStatusVisible(TxFilterStatus status, bool visible);
+
+    // empty list accepts every asset, otherwise a transaction should touch any of |assets|
+    [[nodiscard]] const std::vector<beam::Asset::ID>& getAssets() const;
+    void setAssets(std::vector<beam::Asset::ID> assets);
+
+    [[nodiscard]] bool getDexOnly() const;
+    void setDexOnly(bool value);
+
+    // empty string accepts every transaction, kAllDapps any DApp transaction, otherwise the DApp id
+    [[nodiscard]] const QString& getDappFilter() const;
+    void setDappFilter(const QString& value);
+
+    [[nodiscard]] const QString& getSearchText() const;
+    void setSearchText(const QString& value);
+
+signals:
+    void countChanged();
+
+private:
+    // rows a criteria change can affect
+    enum class Scope
+    {
+        Accepted,   // the criteria got narrower
+        Rejected,   // the criteria got wider
+        All
+    };
+
+    // typed values of a source row the criteria look at
+    struct Columns
+    {
+        TxFilterStatus status = TxFilterStatus::Unknown;
+        bool isDex = false;
+        bool isDapp = false;
+        QString appId;
+        std::vector<beam::Asset::ID> assets;
+    };
+
+    [[nodiscard]] bool acceptsRow(int sourceRow) const;
+    [[nodiscard]] bool matchesText(int sourceRow) const;
+    void refilter(Scope scope);
+    void acceptRows(const std::vector<int>& sourceRows);
+    void rejectRows(const std::vector<int>& sourceRows);
+    void touchRows(std::vector<int> proxyRows, const QVector<int>& roles = QVector<int>());
+
+    void trackRow(int sourceRow);
+    void untrackRow(int sourceRow);
+    void shiftRows(int from, int delta);
+    void rebuild();
+
+    void onSourceRowsInserted(const QModelIndex& parent, int first, int last);
+    void onSourceRowsAboutToBeRemoved(const QModelIndex& parent, int first, int last);
+    void onSourceRowsRemoved(const QModelIndex& parent, int first, int last);
+    void onSourceDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight, const QVector<int>& roles);
+    void onSourceAboutToBeReset();
+    void onSourceReset();
+
+    static constexpr size_t kStatusCount = static_cast<size_t>(TxFilterStatus::Count);
+
+    TxObjectList& _source;
+
+    std::array<bool, kStatusCount> _statusVisible;
+    std::vector<beam::Asset::ID> _assets;   // sorted
+    bool _dexOnly = false;
+    QString _dappFilter;
+    QString _searchText;
+
+    std::array<std::vector<int>, kStatusCount> _statusRows;   // source rows of every status group
+    std::vector<Columns> _columns;                             // per source row
+    std::vector<int> _rowStatusPos;                            // position of a source row in its group
+
+    std::vector<int> _rows;         // accepted source rows, in proxy order
+    std::vector<int> _proxyRows;    // proxy row of every source row, -1 if rejected
+};
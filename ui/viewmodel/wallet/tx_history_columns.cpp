@@ -0,0 +1,176 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "tx_history_columns.h"
+#include <QSaveFile>
+#include <QtEndian>
+#include <type_traits>
+
+namespace
+{
+    const char kMagic[4] = { 'B', 'T', 'X', 'C' };
+    constexpr uint32_t kVersion = 1;
+    constexpr uint64_t kAlignment = 8;
+
+    struct ColumnEntry
+    {
+        uint32_t id;
+        uint32_t width;
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    struct ColumnData
+    {
+        TxHistoryColumns::Column id;
+        uint32_t width;
+        const char* data;
+        uint64_t size;
+    };
+
+    template <typename T>
+    ColumnData makeColumn(TxHistoryColumns::Column id, const std::vector<T>& values)
+    {
+        return { id, static_cast<uint32_t>(sizeof(T)), reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T) };
+    }
+
+    uint64_t align(uint64_t offset)
+    {
+        return (offset + kAlignment - 1) / kAlignment * kAlignment;
+    }
+
+    template <typename T>
+    bool writeValue(QSaveFile& file, T value)
+    {
+        static_assert(std::is_integral_v<T>);
+        value = qToLittleEndian(value);
+        return file.write(reinterpret_cast<const char*>(&value), sizeof(T)) == static_cast<qint64>(sizeof(T));
+    }
+
+    bool writePadding(QSaveFile& file)
+    {
+        static const char zeros[kAlignment] = {};
+        const auto pos = static_cast<uint64_t>(file.pos());
+        const auto padding = static_cast<qint64>(align(pos) - pos);
+        return padding == 0 || file.write(zeros, padding) == padding;
+    }
+
+    std::string toAddressString(const beam::wallet::WalletID& walletID)
+    {
+        return walletID != beam::Zero ? std::to_string(walletID) : std::string();
+    }
+}
+
+void TxHistoryColumns::append(const beam::wallet::TxDescription& tx)
+{
+    // columns are written as they are kept, so they are kept little-endian
+    _createTime.push_back(qToLittleEndian<uint64_t>(tx.m_createTime));
+    _amount.push_back(qToLittleEndian<uint64_t>(tx.m_amount));
+    _fee.push_back(qToLittleEndian<uint64_t>(tx.m_fee));
+    _assetId.push_back(qToLittleEndian<uint32_t>(tx.m_assetId));
+    _status.push_back(static_cast<uint8_t>(tx.m_status));
+    _txType.push_back(static_cast<uint8_t>(tx.m_txType));
+    _flags.push_back((tx.m_sender ? Sender : 0) | (tx.m_selfTx ? SelfTx : 0));
+    _txId.push_back(tx.m_txId);
+    _peerAddress.push_back(qToLittleEndian(addString(toAddressString(tx.m_peerAddr))));
+    _myAddress.push_back(qToLittleEndian(addString(toAddressString(tx.m_myAddr))));
+    _comment.push_back(qToLittleEndian(addString(std::string(tx.m_message.begin(), tx.m_message.end()))));
+}
+
+size_t TxHistoryColumns::size() const
+{
+    return _createTime.size();
+}
+
+uint32_t TxHistoryColumns::addString(std::string value)
+{
+    auto [it, inserted] = _stringIndex.try_emplace(std::move(value), static_cast<uint32_t>(_strings.size()));
+    if (inserted)
+    {
+        _strings.push_back(it->first);
+    }
+    return it->second;
+}
+
+bool TxHistoryColumns::write(const QString& path) const
+{
+    const std::vector<ColumnData> columns =
+    {
+        makeColumn(Column::CreateTime, _createTime),
+        makeColumn(Column::Amount, _amount),
+        makeColumn(Column::Fee, _fee),
+        makeColumn(Column::AssetId, _assetId),
+        makeColumn(Column::Status, _status),
+        makeColumn(Column::TxType, _txType),
+        makeColumn(Column::Flags, _flags),
+        makeColumn(Column::TxId, _txId),
+        makeColumn(Column::PeerAddress, _peerAddress),
+        makeColumn(Column::MyAddress, _myAddress),
+        makeColumn(Column::Comment, _comment)
+    };
+
+    // offsets are known up front, so the file is written in one pass
+    const uint64_t headerSize = sizeof(kMagic) + sizeof(uint32_t) + sizeof(uint64_t) + 2 * sizeof(uint32_t);
+    uint64_t offset = align(headerSize + columns.size() * sizeof(ColumnEntry));
+
+    std::vector<ColumnEntry> directory;
+    directory.reserve(columns.size());
+    for (const auto& column : columns)
+    {
+        directory.push_back({ static_cast<uint32_t>(column.id), column.width, offset, column.size });
+        offset = align(offset + column.size);
+    }
+
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        return false;
+    }
+
+    bool ok = file.write(kMagic, sizeof(kMagic)) == static_cast<qint64>(sizeof(kMagic))
+        && writeValue(file, kVersion)
+        && writeValue(file, static_cast<uint64_t>(size()))
+        && writeValue(file, static_cast<uint32_t>(columns.size()))
+        && writeValue(file, uint32_t(0));
+
+    for (size_t i = 0; ok && i < directory.size(); ++i)
+    {
+        ok = writeValue(file, directory[i].id)
+            && writeValue(file, directory[i].width)
+            && writeValue(file, directory[i].offset)
+            && writeValue(file, directory[i].size);
+    }
+
+    for (size_t i = 0; ok && i < columns.size(); ++i)
+    {
+        ok = writePadding(file)
+            && file.write(columns[i].data, columns[i].size) == static_cast<qint64>(columns[i].size);
+    }
+
+    ok = ok && writePadding(file) && writeValue(file, static_cast<uint64_t>(_strings.size()));
+
+    uint64_t stringOffset = 0;
+    for (size_t i = 0; ok && i < _strings.size(); ++i)
+    {
+        ok = writeValue(file, stringOffset);
+        stringOffset += _strings[i].size();
+    }
+    ok = ok && writeValue(file, stringOffset);
+
+    for (size_t i = 0; ok && i < _strings.size(); ++i)
+    {
+        ok = file.write(_strings[i].data(), _strings[i].size()) == static_cast<qint64>(_strings[i].size());
+    }
+
+    return ok && file.commit();
+}
@@ -0,0 +1,76 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QString>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "wallet/core/common.h"
+
+// Transaction history as fixed width columns, meant to be mapped into memory
+// instead of being parsed. Strings (addresses, comments) are stored once in
+// a dictionary and referenced by index from their columns.
+//
+// File layout, little-endian, every section starts at an 8 byte boundary:
+//   header      "BTXC", u32 version, u64 rows, u32 columns, u32 reserved
+//   directory   per column: u32 id, u32 value width, u64 offset, u64 size
+//   columns     values of every row, in the directory order
+//   dictionary  u64 count, u64 offsets[count + 1], UTF-8 bytes of all strings
+class TxHistoryColumns
+{
+public:
+    enum class Column : uint32_t
+    {
+        CreateTime = 1, // u64, seconds
+        Amount,         // u64, groth
+        Fee,            // u64, groth
+        AssetId,        // u32
+        Status,         // u8, beam::wallet::TxStatus
+        TxType,         // u8, beam::wallet::TxType
+        Flags,          // u8, see Flag
+        TxId,           // 16 bytes
+        PeerAddress,    // u32, dictionary index
+        MyAddress,      // u32, dictionary index
+        Comment         // u32, dictionary index
+    };
+
+    enum Flag : uint8_t
+    {
+        Sender = 1,
+        SelfTx = 2
+    };
+
+    void append(const beam::wallet::TxDescription& tx);
+    [[nodiscard]] size_t size() const;
+    [[nodiscard]] bool write(const QString& path) const;
+
+private:
+    uint32_t addString(std::string value);
+
+    std::vector<uint64_t> _createTime;
+    std::vector<uint64_t> _amount;
+    std::vector<uint64_t> _fee;
+    std::vector<uint32_t> _assetId;
+    std::vector<uint8_t> _status;
+    std::vector<uint8_t> _txType;
+    std::vector<uint8_t> _flags;
+    std::vector<beam::wallet::TxID> _txId;
+    std::vector<uint32_t> _peerAddress;
+    std::vector<uint32_t> _myAddress;
+    std::vector<uint32_t> _comment;
+
+    std::vector<std::string> _strings;
+    std::unordered_map<std::string, uint32_t> _stringIndex;
+};
@@ -0,0 +1,102 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "tx_history_columns_exporter.h"
+#include <algorithm>
+
+TxHistoryColumnsExporter::TxHistoryColumnsExporter(const QString& path, qint64 expectedRows, QObject* parent)
+    : QObject(parent)
+    , _path(path)
+    , _expectedRows(expectedRows)
+{
+    _pool.setMaxThreadCount(1);
+}
+
+TxHistoryColumnsExporter::~TxHistoryColumnsExporter()
+{
+    _cancelled = true;
+    _pool.waitForDone();
+}
+
+const QString& TxHistoryColumnsExporter::getPath() const
+{
+    return _path;
+}
+
+bool TxHistoryColumnsExporter::acceptsPages() const
+{
+    return !_finishing;
+}
+
+void TxHistoryColumnsExporter::addPage(std::vector<beam::wallet::TxDescription> page, bool last)
+{
+    if (!acceptsPages())
+    {
+        return;
+    }
+
+    _pool.start(QRunnable::create([this, page = std::move(page)]() mutable
+    {
+        if (_cancelled)
+        {
+            return;
+        }
+
+        for (const auto& tx : page)
+        {
+            _columns.append(tx);
+        }
+        reportAppended(static_cast<qint64>(page.size()));
+        page.clear();
+    }));
+
+    if (last)
+    {
+        scheduleFinish();
+    }
+}
+
+void TxHistoryColumnsExporter::cancel()
+{
+    _cancelled = true;
+    if (!_finishing)
+    {
+        scheduleFinish();
+    }
+}
+
+void TxHistoryColumnsExporter::reportAppended(qint64 rows)
+{
+    const auto appended = _appended += rows;
+    QMetaObject::invokeMethod(this, [this, appended]()
+    {
+        // the history may have grown since the export started
+        emit progress(appended, std::max(appended, _expectedRows));
+    }, Qt::QueuedConnection);
+}
+
+void TxHistoryColumnsExporter::scheduleFinish()
+{
+    _finishing = true;
+    _pool.start(QRunnable::create([this]()
+    {
+        // the file is saved atomically, a cancelled or failed export leaves nothing behind
+        const bool succeeded = !_cancelled && _columns.write(_path);
+        _columns = TxHistoryColumns();
+
+        QMetaObject::invokeMethod(this, [this, succeeded]()
+        {
+            emit finished(succeeded);
+        }, Qt::QueuedConnection);
+    }));
+}
@@ -0,0 +1,59 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QObject>
+#include <QThreadPool>
+#include <atomic>
+#include <vector>
+#include "tx_history_columns.h"
+
+// Writes the transaction history as columns off the UI thread.
+// The wallet thread only reads the history pages, every page is appended to the columns
+// on a worker thread and released right after, the file is written there once the last
+// page arrived.
+class TxHistoryColumnsExporter : public QObject
+{
+    Q_OBJECT
+public:
+    // expectedRows only scales the progress, the export ends with the last page
+    TxHistoryColumnsExporter(const QString& path, qint64 expectedRows, QObject* parent = nullptr);
+    ~TxHistoryColumnsExporter() override;
+
+    [[nodiscard]] const QString& getPath() const;
+    [[nodiscard]] bool acceptsPages() const;
+    void addPage(std::vector<beam::wallet::TxDescription> page, bool last);
+
+    // stops appending and leaves no file behind
+    void cancel();
+
+signals:
+    void progress(qint64 written, qint64 total);
+    void finished(bool succeeded);
+
+private:
+    void reportAppended(qint64 rows);
+    void scheduleFinish();
+
+    QString _path;
+    qint64 _expectedRows;
+
+    // UI thread
+    bool _finishing = false;
+
+    QThreadPool _pool;          // appends pages and writes the file, one task at a time
+    TxHistoryColumns _columns;  // worker thread only
+    std::atomic<qint64> _appended = 0;
+    std::atomic<bool> _cancelled = false;
+};
@@ -0,0 +1,281 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "tx_history_exporter.h"
+#include <QFile>
+#include <algorithm>
+#include <zlib.h>
+#include "quazip/quazip.h"
+#include "quazip/quazipfile.h"
+
+namespace
+{
+    constexpr qint64 kChunkSize = 256 * 1024;
+}
+
+TxHistoryExporter::TxHistoryExporter(const QString& path, int partsCount, Mode mode, int compressionLevel, QObject* parent)
+    : QObject(parent)
+    , _path(path)
+    , _mode(mode)
+    , _compressionLevel(compressionLevel)
+    , _partsLeft(partsCount)
+{
+    _pool.setMaxThreadCount(1);
+}
+
+TxHistoryExporter::~TxHistoryExporter()
+{
+    _cancelled = true;
+    _deflatePool.waitForDone();
+    _pool.waitForDone();
+
+    if (_zip && _zip->isOpen())
+    {
+        _zip->close();
+        QFile::remove(_path);
+    }
+}
+
+const QString& TxHistoryExporter::getPath() const
+{
+    return _path;
+}
+
+bool TxHistoryExporter::acceptsPart(const QString& name) const
+{
+    return _partsLeft > 0 && !_parts.contains(name);
+}
+
+void TxHistoryExporter::addPart(const QString& name, QByteArray data)
+{
+    if (!acceptsPart(name))
+    {
+        return;
+    }
+
+    _parts.insert(name);
+    _total += data.size();
+    const bool last = --_partsLeft == 0;
+    emit progress(_written, _total);
+
+    if (_mode == Mode::Parallel)
+    {
+        const auto index = _deflated.size();
+        _deflated.emplace_back();
+        ++_deflatesLeft;
+
+        _deflatePool.start(QRunnable::create([this, index, name, data = std::move(data)]() mutable
+        {
+            DeflatedPart part;
+            part.name = name;
+            const bool succeeded = deflatePart(data, part);
+            data.clear();
+
+            QMetaObject::invokeMethod(this, [this, index, part = std::move(part), succeeded]() mutable
+            {
+                onPartDeflated(index, std::move(part), succeeded);
+            }, Qt::QueuedConnection);
+        }));
+        return;
+    }
+
+    _finishing = last;
+    _pool.start(QRunnable::create([this, name, data = std::move(data), last]() mutable
+    {
+        writePart(name, data);
+        data.clear();
+
+        if (last)
+        {
+            finish();
+        }
+    }));
+}
+
+void TxHistoryExporter::cancel()
+{
+    _cancelled = true;
+    _partsLeft = 0;
+
+    // parts still deflating report back and close the archive after the last one
+    if (!_finishing && _deflatesLeft == 0)
+    {
+        scheduleFinish(false);
+    }
+}
+
+bool TxHistoryExporter::openArchive()
+{
+    if (!_zip)
+    {
+        _zip = std::make_unique<QuaZip>(_path);
+        if (!_zip->open(QuaZip::mdCreate))
+        {
+            _failed = true;
+        }
+    }
+    return !_failed;
+}
+
+void TxHistoryExporter::writePart(const QString& name, const QByteArray& data)
+{
+    if (_cancelled || !openArchive())
+    {
+        return;
+    }
+
+    QuaZipFile zipFile(_zip.get());
+    if (!zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo(name), nullptr, 0, Z_DEFLATED, _compressionLevel))
+    {
+        _failed = true;
+        return;
+    }
+
+    for (qint64 offset = 0; offset < data.size() && !_cancelled; offset += kChunkSize)
+    {
+        const auto size = std::min(kChunkSize, data.size() - offset);
+        if (zipFile.write(data.constData() + offset, size) != size)
+        {
+            _failed = true;
+            break;
+        }
+        reportWritten(size);
+    }
+    zipFile.close();
+}
+
+void TxHistoryExporter::writeDeflatedParts(const std::vector<DeflatedPart>& parts)
+{
+    for (const auto& part : parts)
+    {
+        if (_cancelled || !openArchive())
+        {
+            return;
+        }
+
+        // the member is already deflated, it only needs its crc and original size
+        QuaZipNewInfo info(part.name);
+        info.uncompressedSize = static_cast<ulong>(part.size);
+
+        QuaZipFile zipFile(_zip.get());
+        if (!zipFile.open(QIODevice::WriteOnly, info, nullptr, part.crc, Z_DEFLATED, _compressionLevel, true)
+            || zipFile.write(part.data) != part.data.size())
+        {
+            _failed = true;
+            return;
+        }
+        zipFile.close();
+    }
+}
+
+bool TxHistoryExporter::deflatePart(const QByteArray& data, DeflatedPart& part)
+{
+    z_stream stream{};
+    if (deflateInit2(&stream, _compressionLevel, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        return false;
+    }
+
+    // the bound of the whole input, so no deflate call runs out of output space
+    part.data.resize(static_cast<int>(deflateBound(&stream, static_cast<uLong>(data.size()))));
+    part.crc = crc32(0L, Z_NULL, 0);
+    part.size = data.size();
+
+    stream.next_out = reinterpret_cast<Bytef*>(part.data.data());
+    stream.avail_out = static_cast<uInt>(part.data.size());
+
+    int result = Z_OK;
+    qint64 offset = 0;
+    do
+    {
+        if (_cancelled)
+        {
+            deflateEnd(&stream);
+            return false;
+        }
+
+        const auto size = std::min(kChunkSize, data.size() - offset);
+        auto chunk = reinterpret_cast<const Bytef*>(data.constData() + offset);
+        part.crc = crc32(part.crc, chunk, static_cast<uInt>(size));
+
+        stream.next_in = const_cast<Bytef*>(chunk);
+        stream.avail_in = static_cast<uInt>(size);
+        offset += size;
+
+        result = deflate(&stream, offset == data.size() ? Z_FINISH : Z_NO_FLUSH);
+        reportWritten(size);
+    } while (result == Z_OK);
+
+    part.data.resize(static_cast<int>(stream.total_out));
+    deflateEnd(&stream);
+    return result == Z_STREAM_END;
+}
+
+void TxHistoryExporter::onPartDeflated(size_t index, DeflatedPart&& part, bool succeeded)
+{
+    --_deflatesLeft;
+    if (succeeded)
+    {
+        _deflated[index] = std::move(part);
+    }
+    else if (!_cancelled)
+    {
+        _failed = true;
+    }
+
+    if (_deflatesLeft == 0 && _partsLeft == 0 && !_finishing)
+    {
+        scheduleFinish(!_cancelled && !_failed);
+    }
+}
+
+void TxHistoryExporter::reportWritten(qint64 size)
+{
+    const auto written = _written += size;
+    QMetaObject::invokeMethod(this, [this, written]()
+    {
+        emit progress(written, _total);
+    }, Qt::QueuedConnection);
+}
+
+void TxHistoryExporter::scheduleFinish(bool writeDeflated)
+{
+    _finishing = true;
+    _pool.start(QRunnable::create([this, writeDeflated, parts = std::move(_deflated)]()
+    {
+        if (writeDeflated)
+        {
+            writeDeflatedParts(parts);
+        }
+        finish();
+    }));
+}
+
+void TxHistoryExporter::finish()
+{
+    if (_zip && _zip->isOpen())
+    {
+        _zip->close();
+    }
+
+    const bool succeeded = !_cancelled && !_failed;
+    if (!succeeded)
+    {
+        QFile::remove(_path);
+    }
+
+    QMetaObject::invokeMethod(this, [this, succeeded]()
+    {
+        emit finished(succeeded);
+    }, Qt::QueuedConnection);
+}
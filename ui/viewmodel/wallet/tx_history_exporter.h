@@ -0,0 +1,90 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QObject>
+#include <QSet>
+#include <QThreadPool>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+class QuaZip;
+
+// Writes an exported transaction history into a zip archive off the UI thread.
+// In the streaming mode every CSV part is deflated in fixed size chunks on
+// a worker thread as soon as the wallet delivers it and released right after.
+// In the parallel mode all parts are deflated at the same time on a thread pool
+// and the compressed members are copied into the archive once all are done.
+class TxHistoryExporter : public QObject
+{
+    Q_OBJECT
+public:
+    enum class Mode
+    {
+        Streaming,
+        Parallel
+    };
+
+    TxHistoryExporter(const QString& path, int partsCount, Mode mode, int compressionLevel, QObject* parent = nullptr);
+    ~TxHistoryExporter() override;
+
+    [[nodiscard]] const QString& getPath() const;
+    [[nodiscard]] bool acceptsPart(const QString& name) const;
+    void addPart(const QString& name, QByteArray data);
+
+    // stops writing and removes the unfinished archive
+    void cancel();
+
+signals:
+    void progress(qint64 written, qint64 total);
+    void finished(bool succeeded);
+
+private:
+    struct DeflatedPart
+    {
+        QString name;
+        QByteArray data;
+        quint32 crc = 0;
+        qint64 size = 0;
+    };
+
+    bool openArchive();
+    void writePart(const QString& name, const QByteArray& data);
+    void writeDeflatedParts(const std::vector<DeflatedPart>& parts);
+    bool deflatePart(const QByteArray& data, DeflatedPart& part);
+    void onPartDeflated(size_t index, DeflatedPart&& part, bool succeeded);
+    void reportWritten(qint64 size);
+    void scheduleFinish(bool writeDeflated);
+    void finish();
+
+    QString _path;
+    Mode _mode;
+    int _compressionLevel;
+
+    // UI thread
+    int _partsLeft;
+    int _deflatesLeft = 0;
+    bool _finishing = false;
+    QSet<QString> _parts;
+    qint64 _total = 0;
+    std::vector<DeflatedPart> _deflated;
+
+    QThreadPool _pool;          // writes the archive, one task at a time
+    QThreadPool _deflatePool;
+    std::unique_ptr<QuaZip> _zip;   // archive writer thread only
+    std::atomic<qint64> _written = 0;
+    std::atomic<bool> _cancelled = false;
+    std::atomic<bool> _failed = false;
+};
@@ -14,8 +14,8 @@
 #include "tx_object.h"
 #include "viewmodel/ui_helpers.h"
 #include "viewmodel/qml_globals.h"
+#include "viewmodel/helpers/string_pool.h"
 #include "wallet/core/common.h"
-#include "wallet/core/simple_transaction.h"
 #include "wallet/core/strings_resources.h"
 #include "model/app_model.h"
 
@@ -24,16 +24,12 @@ using namespace beamui;
 
 namespace
 {
-    QString getWaitingPeerStr(const beam::wallet::TxParameters& txParameters, bool isSender)
+    QString getWaitingPeerStr(beam::Height peerResponseHeight, bool isSender)
     {
-        using namespace beam::wallet;
-
-        auto minHeight = txParameters.GetParameter<beam::Height>(TxParameterID::MinHeight);
-        auto responseTime = txParameters.GetParameter<beam::Height>(TxParameterID::PeerResponseTime);
         QString time = "";
-        if (minHeight && responseTime)
+        if (peerResponseHeight)
         {
-            time = convertBeamHeightDiffToTime(*minHeight + *responseTime - AppModel::getInstance().getWalletModel()->getCurrentHeight());
+            time = convertBeamHeightDiffToTime(peerResponseHeight - AppModel::getInstance().getWalletModel()->getCurrentHeight());
         }
         if (isSender)
         {
@@ -44,12 +40,9 @@ namespace
         return qtTrId("tx-state-initial-receiver").arg(time);
     }
 
-    QString getInProgressStr(const beam::wallet::TxParameters& txParameters)
+    QString getInProgressStr(beam::Height maxHeight, beam::Height lifetime)
     {
-        using namespace beam::wallet;
-
         const Height kNormalTxConfirmationDelay = 10;
-        auto maxHeight = txParameters.GetParameter<beam::Height>(TxParameterID::MaxHeight);
         QString time = "";
         if (!maxHeight)
         {
@@ -57,19 +50,18 @@ namespace
         }
 
         auto currentHeight = AppModel::getInstance().getWalletModel()->getCurrentHeight();
-        if (currentHeight >= *maxHeight)
+        if (currentHeight >= maxHeight)
         {
             return "";
         }
 
-        Height delta =  *maxHeight - currentHeight;
-        auto lifetime = txParameters.GetParameter<beam::Height>(TxParameterID::Lifetime);
-        if (!lifetime || *lifetime < delta)
+        Height delta =  maxHeight - currentHeight;
+        if (!lifetime || lifetime < delta)
         {
             return "";
         }
 
-        if (*lifetime - delta <= kNormalTxConfirmationDelay)
+        if (lifetime - delta <= kNormalTxConfirmationDelay)
         {
             //% "The transaction is usually expected to complete in a few minutes."
             return qtTrId("tx-state-in-progress-normal");
@@ -85,36 +77,53 @@ namespace
     }
 }
 
-TxObject::TxObject(beam::wallet::TxDescription tx, QObject* parent)
-    : TxObject(std::move(tx), beam::wallet::Currency::UNKNOWN(), parent)
+TxObject::TxObject(const beam::wallet::TxDescription& tx)
+    : TxObject(tx, beam::wallet::Currency::UNKNOWN())
 {
 }
 
-TxObject::TxObject(beam::wallet::TxDescription tx, beam::wallet::Currency secondCurrency, QObject* parent)
-    : QObject(parent)
-    , _tx(std::move(tx))
-    , _secondCurrency(secondCurrency)
+TxObject::TxObject(const beam::wallet::TxDescription& tx, const beam::wallet::Currency& secondCurrency)
+    : _txId(tx.m_txId)
+    , _kernelID(tx.m_kernelID)
+    , _myAddr(tx.m_myAddr)
+    , _peerAddr(tx.m_peerAddr)
+    , _createTime(tx.m_createTime)
+    , _amount(tx.m_amount)
+    , _rate(tx.getExchangeRate(secondCurrency, tx.m_assetId))
+    , _feeRate(tx.getExchangeRate(secondCurrency, beam::Asset::s_BeamID))
+    , _token(QString::fromStdString(tx.getToken()))
+    , _senderEndpoint(QString::fromStdString(tx.getSenderEndpoint()))
+    , _receiverEndpoint(QString::fromStdString(tx.getReceiverEndpoint()))
+    , _secondCurrency(StringPool::intern(QString::fromStdString(secondCurrency.m_value).toUpper()))
+    , _assetId(tx.m_assetId)
+    , _txStatus(tx.m_status)
+    , _failureReason(tx.m_failureReason)
+    , _txType(tx.m_txType)
 {
     using namespace beam;
     using namespace beam::wallet;
 
-    Height h = tx.m_minHeight;
-    _contractFee = std::max(_tx.m_fee, Transaction::FeeSettings::get(h).get_DefaultStd());
+    setFlag(Sender, tx.m_sender);
+    setFlag(SelfTx, tx.m_selfTx);
+    setFlag(CanCancel, tx.canCancel());
+    setFlag(CanDelete, tx.canDelete());
 
-    auto appendAsset = [&](Asset::ID aid, Amount amount, bool income) {
-        _assetAmounts.emplace_back(AmountToUIString(amount));
-        _assetsList.push_back(aid);
-        _assetAmountsIncome.push_back(income);
-        _assetRates.emplace_back(getRate(aid));
+    auto rateOf = [&tx, &secondCurrency](Asset::ID assetId)
+    {
+        return tx.getExchangeRate(secondCurrency, assetId);
     };
 
-    if (_tx.m_txType == wallet::TxType::Contract)
+    Height h = tx.m_minHeight;
+    Amount contractFee = std::max(tx.m_fee, Transaction::FeeSettings::get(h).get_DefaultStd());
+
+    if (tx.m_txType == wallet::TxType::Contract)
     {
+        bvm2::FundsMap contractSpend;
         bvm2::ContractInvokeData vData;
-        if(_tx.GetParameter(TxParameterID::ContractDataPacked, vData))
+        if(tx.GetParameter(TxParameterID::ContractDataPacked, vData))
         {
-            _contractFee = vData.get_FullFee(h);
-            _contractSpend = vData.m_SpendMax.empty() ? vData.get_FullSpend() : vData.m_SpendMax;
+            contractFee = vData.get_FullFee(h);
+            contractSpend = vData.m_SpendMax.empty() ? vData.get_FullSpend() : vData.m_SpendMax;
         }
 
         if (!vData.m_vec.empty())
@@ -127,60 +136,177 @@ TxObject::TxObject(beam::wallet::TxDescription tx, beam::wallet::Currency second
                 ss << " +" << vData.m_vec.size() - 1;
             }
 
-            _contractCids = QString::fromStdString(ss.str());
+            _contractCids = StringPool::intern(QString::fromStdString(ss.str()));
         }
 
-        for (const auto& info: _contractSpend)
+        for (const auto& info: contractSpend)
         {
             auto amount = info.second;
             if (info.first == beam::Asset::s_BeamID)
             {
                 if (amount < 0)
                 {
-                    amount += _contractFee;
+                    amount += contractFee;
                 }
             }
-            appendAsset(info.first, std::abs(amount), amount <= 0);
+            appendAsset(info.first, std::abs(amount), amount <= 0, rateOf(info.first));
         }
 
+        // a contract call spending nothing is a fee-only transaction, otherwise it is income when nothing is spent
+        setFlag(FeeOnly, contractSpend.empty());
+        setFlag(Income, !contractSpend.empty() && std::none_of(contractSpend.begin(), contractSpend.end(), [](const auto& info)
+        {
+            return info.second > 0;
+        }));
+
         if (isFeeOnly())
         {
-            appendAsset(0, _contractFee, false);
+            appendAsset(0, contractFee, false, rateOf(0));
         }
+
+        _fee = contractFee;
+
+        bool isMarkedAsRead = false;
+        tx.GetParameter(TxParameterID::IsContractNotificationMarkedAsRead, isMarkedAsRead);
+        setFlag(NotificationRead, isMarkedAsRead);
     }
-    else if (_tx.m_txType == beam::wallet::TxType::DexSimpleSwap)
+    else if (tx.m_txType == beam::wallet::TxType::DexSimpleSwap)
     {
-        const auto rasset  = _tx.GetParameter<Asset::ID>(TxParameterID::DexReceiveAsset);
-        const auto ramount = _tx.GetParameter<Amount>(TxParameterID::DexReceiveAmount);
+        const auto rasset  = tx.GetParameter<Asset::ID>(TxParameterID::DexReceiveAsset);
+        const auto ramount = tx.GetParameter<Amount>(TxParameterID::DexReceiveAmount);
         if (!rasset || !ramount)
         {
             throw std::runtime_error("No rasset/ramount on DEX tx");
         }
 
-        appendAsset(*rasset, *ramount, true);
-        appendAsset(_tx.m_assetId, _tx.m_amount, false);
+        appendAsset(*rasset, *ramount, true, rateOf(*rasset));
+        appendAsset(tx.m_assetId, tx.m_amount, false, _rate);
+        setFlag(Income, !tx.m_sender);
     }
     else
     {
-        appendAsset(_tx.m_assetId, _tx.m_amount, !_tx.m_sender);
+        appendAsset(tx.m_assetId, tx.m_amount, !tx.m_sender, _rate);
+        setFlag(Income, !tx.m_sender);
+    }
+
+    if (!isContractTx() && tx.m_fee)
+    {
+        // TODO(zavarza) no fee for shielded inputs after HF3
+        Amount shieldedInputsFee = 0;
+        std::vector<wallet::IPrivateKeyKeeper2::ShieldedInput> inputsShielded;
+        if (tx.GetParameter(wallet::TxParameterID::InputCoinsShielded, inputsShielded))
+        {
+            for (const auto& inputShielded : inputsShielded)
+            {
+                shieldedInputsFee += inputShielded.m_Fee;
+            }
+        }
+        _fee = shieldedInputsFee + tx.m_fee;
     }
 
-    if (!_tx.m_appName.empty())
+    if (!tx.m_appName.empty())
     {
-        _source = QString::fromStdString(_tx.m_appName);
+        _source = StringPool::intern(QString::fromStdString(tx.m_appName));
     }
-    else if (_tx.m_txType == wallet::TxType::DexSimpleSwap)
+    else if (tx.m_txType == wallet::TxType::DexSimpleSwap)
     {
         //% "Assets Swap"
-        _source = qtTrId("source-dex");
+        _source = StringPool::intern(qtTrId("source-dex"));
     }
     else
     {
         //% "Wallet"
-        _source = qtTrId("source-wallet");
+        _source = StringPool::intern(qtTrId("source-wallet"));
+    }
+
+    if (auto appId = tx.GetParameter<std::string>(TxParameterID::AppID); appId && !appId->empty())
+    {
+        _appId = StringPool::intern(QString::fromStdString(*appId));
+        setFlag(DappTx, true);
+    }
+
+    if (auto addressType = tx.GetParameter<TxAddressType>(TxParameterID::AddressType))
+    {
+        _addressType = *addressType;
+    }
+
+    std::string str{tx.m_message.begin(), tx.m_message.end()};
+    _comment = QString(str.c_str()).trimmed();
+    if (isContractTx())
+    {
+        if (_comment.isEmpty())
+        {
+            //% "Contract transaction"
+            _comment = StringPool::intern(qtTrId("tx-contract-default-comment"));
+        }
+    }
+    else if (isDexTx())
+    {
+        //% "Assets Swaps transaction"
+        _comment = StringPool::intern(qtTrId("tx-asset-swap-default-comment"));
+    }
+
+    tx.GetParameter(beam::wallet::TxParameterID::MinConfirmations, _minConfirmations);
+
+    if (isActive() || _minConfirmations)
+    {
+        auto progress = std::make_unique<Progress>();
+
+        auto minHeight = tx.GetParameter<Height>(TxParameterID::MinHeight);
+        auto responseTime = tx.GetParameter<Height>(TxParameterID::PeerResponseTime);
+        if (minHeight && responseTime)
+        {
+            progress->peerResponseHeight = *minHeight + *responseTime;
+        }
+        tx.GetParameter(TxParameterID::MaxHeight, progress->maxHeight);
+        tx.GetParameter(TxParameterID::Lifetime, progress->lifetime);
+        tx.GetParameter(TxParameterID::KernelProofHeight, progress->kernelProofHeight);
+
+        _progress = std::move(progress);
     }
 
-    _tx.GetParameter(beam::wallet::TxParameterID::MinConfirmations, _minConfirmations);
+    const auto status = interpretStatus(tx);
+    _status = StringPool::intern(QString::fromStdString(status));
+    _uiStatus = beamui::getTxUIStatus(status, getAddressType());
+}
+
+void TxObject::appendAsset(beam::Asset::ID assetId, beam::Amount amount, bool income, beam::Amount rate)
+{
+    AssetAmount asset;
+    asset.amount = amount;
+    asset.rate = rate;
+    asset.assetId = assetId;
+    asset.income = income;
+
+    if (!hasFlag(HasAsset))
+    {
+        _asset = asset;
+        setFlag(HasAsset, true);
+    }
+    else
+    {
+        _moreAssets.push_back(asset);
+    }
+}
+
+const TxObject::AssetAmount& TxObject::assetAt(size_t index) const
+{
+    return index == 0 ? _asset : _moreAssets[index - 1];
+}
+
+size_t TxObject::assetCount() const
+{
+    return hasFlag(HasAsset) ? _moreAssets.size() + 1 : 0;
+}
+
+bool TxObject::hasFlag(Flag flag) const
+{
+    return (_flags & flag) != 0;
+}
+
+void TxObject::setFlag(Flag flag, bool value)
+{
+    _flags = value ? (_flags | flag) : (_flags & ~flag);
 }
 
 bool TxObject::operator==(const TxObject& other) const
@@ -188,9 +314,47 @@ bool TxObject::operator==(const TxObject& other) const
     return getTxID() == other.getTxID();
 }
 
+bool TxObject::isHistoryTx(const beam::wallet::TxDescription& tx)
+{
+    using namespace beam::wallet;
+
+    const auto txType = tx.GetParameter<TxType>(TxParameterID::TransactionType);
+    if (!txType)
+    {
+        return false;
+    }
+
+    switch(*txType)
+    {
+    case TxType::AtomicSwap:
+    case TxType::AssetIssue:
+    case TxType::AssetConsume:
+    case TxType::AssetReg:
+    case TxType::AssetUnreg:
+    case TxType::AssetInfo:
+    case TxType::PullTransaction:
+    case TxType::UnlinkFunds:
+    case TxType::VoucherRequest:
+    case TxType::VoucherResponse:
+    case TxType::InstantSbbsMessage:
+        return false;
+
+    case TxType::ALL:
+        assert(!"This should not happen");
+        return false;
+
+    case TxType::Contract:
+    case TxType::PushTransaction:
+    case TxType::Simple:
+    case TxType::DexSimpleSwap:
+        return true;
+    }
+    return false;
+}
+
 beam::Timestamp TxObject::timeCreated() const
 {
-    return _tx.m_createTime;
+    return _createTime;
 }
 
 QString TxObject::getSource() const
@@ -200,7 +364,7 @@ QString TxObject::getSource() const
 
 uint32_t TxObject::getMinConfirmations() const
 {
-    return _tx.m_txType == wallet::TxType::Simple ? _minConfirmations : 0;
+    return _txType == wallet::TxType::Simple ? _minConfirmations : 0;
 }
 
 QString TxObject::getConfirmationProgress() const
@@ -210,10 +374,10 @@ QString TxObject::getConfirmationProgress() const
         auto currHeight = AppModel::getInstance().getWalletModel()->getCurrentHeight();
         if (currHeight && _minConfirmations)
         {
-            if (auto proofHeight = _tx.GetParameter<Height>(wallet::TxParameterID::KernelProofHeight); proofHeight)
+            if (auto proofHeight = _progress->kernelProofHeight; proofHeight)
             {
                 std::stringstream ss;
-                auto blocksAfter = (currHeight - *proofHeight);
+                auto blocksAfter = (currHeight - proofHeight);
                 ss << (blocksAfter > _minConfirmations ? _minConfirmations : blocksAfter) << "/" << _minConfirmations;
                 return QString::fromStdString(ss.str());
             }
@@ -231,56 +395,16 @@ QString TxObject::getConfirmationProgress() const
 
 beam::wallet::TxID TxObject::getTxID() const
 {
-    return _tx.m_txId;
+    return _txId;
 }
 
 bool TxObject::isIncome() const
 {
-    if (isContractTx())
-    {
-        if (isFeeOnly())
-        {
-            // this is a fee-only transaction
-            return false;
-        }
-
-        for (const auto& info : _contractSpend) {
-            if (info.second > 0)
-                return false;
-        }
-
-        return true;
-    }
-    else
-    {
-        return !_tx.m_sender;
-    }
+    return hasFlag(Income);
 }
 
 const QString& TxObject::getComment() const
 {
-    if (_comment.isEmpty())
-    {
-        std::string str{_tx.m_message.begin(), _tx.m_message.end()};
-        auto comment = QString(str.c_str()).trimmed();
-
-        if (isContractTx())
-        {
-            if (comment.isEmpty())
-            {
-                //% "Contract transaction"
-                comment = qtTrId("tx-contract-default-comment");
-            }
-        }
-        else if (isDexTx())
-        {
-            //% "Assets Swaps transaction"
-            comment = qtTrId("tx-asset-swap-default-comment");
-        }
-
-        _comment = comment;
-    }
-
     return _comment;
 }
 
@@ -288,7 +412,26 @@ QString TxObject::getRate(beam::Asset::ID assetId) const
 {
     using namespace beam::wallet;
 
-    auto rate = getTxDescription().getExchangeRate(_secondCurrency, assetId);
+    Amount rate = 0;
+    if (assetId == _assetId)
+    {
+        rate = _rate;
+    }
+    else if (assetId == beam::Asset::s_BeamID)
+    {
+        rate = _feeRate;
+    }
+    else
+    {
+        for (size_t i = 0; i < assetCount(); ++i)
+        {
+            if (assetAt(i).assetId == assetId)
+            {
+                rate = assetAt(i).rate;
+                break;
+            }
+        }
+    }
     return rate ? AmountToUIString(rate) : "0";
 }
 
@@ -304,119 +447,88 @@ QString TxObject::getCidsStr() const
 
 QString TxObject::getRate() const
 {
-    return getRate(_tx.m_assetId);
+    return getRate(_assetId);
 }
 
 bool TxObject::isActive() const
 {
     using namespace beam::wallet;
 
-    return _tx.m_status == TxStatus::Pending ||
-           _tx.m_status == TxStatus::InProgress ||
-           _tx.m_status == TxStatus::Registering ||
-           _tx.m_status == TxStatus::Confirming;
+    return _txStatus == TxStatus::Pending ||
+           _txStatus == TxStatus::InProgress ||
+           _txStatus == TxStatus::Registering ||
+           _txStatus == TxStatus::Confirming;
 }
 
 QString TxObject::getStatus() const
 {
-    return beam::wallet::interpretStatus(_tx).c_str();
+    return _status;
 }
 
 bool TxObject::isCancelAvailable() const
 {
-    return _tx.canCancel();
+    return hasFlag(CanCancel);
 }
 
 bool TxObject::isDeleteAvailable() const
 {
-    return _tx.canDelete();
+    return hasFlag(CanDelete);
 }
 
 QString TxObject::getAddressFrom() const
 {
-    if (_tx.m_txType == wallet::TxType::PushTransaction && !_tx.m_sender)
+    if (_txType == wallet::TxType::PushTransaction && !hasFlag(Sender))
     {
         return getSenderEndpoint();
     }
-    return toString(_tx.m_sender ? _tx.m_myAddr : _tx.m_peerAddr);
+    return toString(hasFlag(Sender) ? _myAddr : _peerAddr);
 }
 
 QString TxObject::getAddressTo() const
 {
-    if (_tx.m_sender)
+    if (hasFlag(Sender))
     {
         auto token = getToken();
         if (token.isEmpty())
-            return toString(_tx.m_peerAddr);
+            return toString(_peerAddr);
 
         return token;
     }
-    return toString(_tx.m_myAddr);
+    return toString(_myAddr);
 }
 
 QString TxObject::getAmountGeneral() const
 {
     if (isContractTx())
     {
-        return *_assetAmounts.begin();
+        return AmountToUIString(_asset.amount);
     }
     else
     {
-        return AmountToUIString(_tx.m_amount);
+        return AmountToUIString(_amount);
     }
 }
 
-
 QString TxObject::getFee() const
 {
-    if (isContractTx())
-    {
-        if (_contractFee)
-        {
-            return AmountToUIString(_contractFee);
-        }
-    }
-    else if (_tx.m_fee)
-    {
-        // TODO(zavarza) no fee for shielded inputs after HF3
-        Amount shieldedInputsFee = 0;
-        std::vector<wallet::IPrivateKeyKeeper2::ShieldedInput> inputsShielded;
-        if (_tx.GetParameter(wallet::TxParameterID::InputCoinsShielded, inputsShielded))
-        {
-            for (const auto& inputShielded : inputsShielded)
-            {
-                shieldedInputsFee += inputShielded.m_Fee;
-            }
-        }
-        return AmountToUIString(shieldedInputsFee + _tx.m_fee);
-    }
-    return QString{};
-}
-
-const beam::wallet::TxDescription& TxObject::getTxDescription() const
-{
-    return _tx;
+    return _fee ? AmountToUIString(_fee) : QString{};
 }
 
 QString TxObject::getKernelID() const
 {
-    if (_kernelIDStr.isEmpty())
-    {
-        _kernelIDStr = QString::fromStdString(to_hex(_tx.m_kernelID.m_pData, static_cast<size_t>(_tx.m_kernelID.nBytes)));
-    }
-    return _kernelIDStr;
+    return QString::fromStdString(to_hex(_kernelID.m_pData, static_cast<size_t>(_kernelID.nBytes)));
 }
 
 QString TxObject::getTransactionID() const
 {
-    return QString::fromStdString(to_hex(_tx.m_txId.data(), _tx.m_txId.size()));
+    return QString::fromStdString(to_hex(_txId.data(), _txId.size()));
 }
 
 QString TxObject::getFailureReason() const
 {
-    if (getTxDescription().m_status == wallet::TxStatus::Failed)
+    if (_txStatus == wallet::TxStatus::Failed)
     {
-        return getReasonString(getTxDescription().m_failureReason);
+        return getReasonString(_failureReason);
     }
 
     return QString();
@@ -424,42 +536,27 @@ QString TxObject::getFailureReason() const
 
 QString TxObject::getStateDetails() const
 {
-    auto& tx = getTxDescription();
-    if (tx.m_txType == beam::wallet::TxType::Simple)
+    if (_txType == beam::wallet::TxType::Simple)
     {
-        switch (tx.m_status)
+        switch (_txStatus)
         {
         case beam::wallet::TxStatus::Pending:
         case beam::wallet::TxStatus::InProgress:
-        {
-            auto state = tx.GetParameter<wallet::SimpleTransaction::State>(beam::wallet::TxParameterID::State);
-            if (state)
-            {
-                switch (*state)
-                {
-                case wallet::SimpleTransaction::Initial:
-                case wallet::SimpleTransaction::Invitation:
-                    return getWaitingPeerStr(tx, tx.m_sender);
-                default:
-                    break;
-                }
-            }
-            return getWaitingPeerStr(tx, tx.m_sender);
-        }
+            return getWaitingPeerStr(_progress->peerResponseHeight, hasFlag(Sender));
         case beam::wallet::TxStatus::Registering:
-            return getInProgressStr(tx);
+            return getInProgressStr(_progress->maxHeight, _progress->lifetime);
         default:
             break;
         }
     }
 
-    if (tx.m_txType == beam::wallet::TxType::PushTransaction)
+    if (_txType == beam::wallet::TxType::PushTransaction)
     {
-        if (tx.m_status == beam::wallet::TxStatus::InProgress)
+        if (_txStatus == beam::wallet::TxStatus::InProgress)
         {
-            return getWaitingPeerStr(tx, tx.m_sender);
+            return getWaitingPeerStr(_progress->peerResponseHeight, hasFlag(Sender));
         }
-        else if (tx.m_status == beam::wallet::TxStatus::Registering)
+        else if (_txStatus == beam::wallet::TxStatus::Registering)
         {
             //% "The transaction is usually expected to complete in a few minutes."
             return qtTrId("tx-state-in-progress-normal");
@@ -470,23 +567,42 @@ QString TxObject::getStateDetails() const
 
 QString TxObject::getToken() const
 {
-    const auto& tx = getTxDescription();
-    return QString::fromStdString(tx.getToken());
+    return _token;
 }
 
 QString TxObject::getSenderEndpoint() const
 {
-    return QString::fromStdString(_tx.getSenderEndpoint());
+    return _senderEndpoint;
 }
 
 QString TxObject::getReceiverIdentity() const
 {
-    return QString::fromStdString(_tx.getReceiverEndpoint());
+    return _receiverEndpoint;
+}
+
+QString TxObject::getSearchText() const
+{
+    QString r = getTransactionID();
+    r.append(" ");
+    r.append(getKernelID());
+    r.append(" ");
+    r.append(getAddressFrom());
+    r.append(" ");
+    r.append(getAddressTo());
+    r.append(" ");
+    r.append(getComment());
+    r.append(" ");
+    r.append(getSenderEndpoint());
+    r.append(" ");
+    r.append(getReceiverIdentity());
+    r.append(" ");
+    r.append(getToken());
+    return r;
 }
 
 bool TxObject::isMultiAsset() const
 {
-    return _assetsList.size() > 1;
+    return assetCount() > 1;
 }
 
 bool TxObject::canShowContractNotification() const
@@ -496,23 +612,26 @@ bool TxObject::canShowContractNotification() const
 
     if (isContractTx() && isActive() && !isDAppStoreTx)
     {
-        bool isMarkedAsRead = false;
-        _tx.GetParameter(beam::wallet::TxParameterID::IsContractNotificationMarkedAsRead, isMarkedAsRead);
-        return !isMarkedAsRead;
+        return !hasFlag(NotificationRead);
     }
     return false;
 }
 
+TxUIStatus TxObject::getUIStatus() const
+{
+    return _uiStatus;
+}
+
 bool TxObject::hasPaymentProof() const
 {
     return !isIncome()
-           && _tx.m_status == beam::wallet::TxStatus::Completed
-           && (_tx.m_txType == beam::wallet::TxType::Simple || _tx.m_txType == beam::wallet::TxType::PushTransaction);
+           && _txStatus == beam::wallet::TxStatus::Completed
+           && (_txType == beam::wallet::TxType::Simple || _txType == beam::wallet::TxType::PushTransaction);
 }
 
 bool TxObject::isInProgress() const
 {
-    switch (_tx.m_status)
+    switch (_txStatus)
     {
         case wallet::TxStatus::Pending:
         case wallet::TxStatus::InProgress:
@@ -523,65 +642,73 @@ bool TxObject::isInProgress() const
     }
 }
 
+TxFilterStatus TxObject::getFilterStatus() const
+{
+    if (isInProgress())
+    {
+        return TxFilterStatus::InProgress;
+    }
+
+    if (isCompleted())
+    {
+        return TxFilterStatus::Completed;
+    }
+
+    if (isCanceled())
+    {
+        return TxFilterStatus::Canceled;
+    }
+
+    if (isFailed())
+    {
+        return TxFilterStatus::Failed;
+    }
+    return TxFilterStatus::Unknown;
+}
+
 bool TxObject::isPending() const
 {
-    return _tx.m_status == wallet::TxStatus::Pending;
+    return _txStatus == wallet::TxStatus::Pending;
 }
 
 bool TxObject::isCompleted() const
 {
-    return _tx.m_status == wallet::TxStatus::Completed || _tx.m_status == wallet::TxStatus::Confirming;
+    return _txStatus == wallet::TxStatus::Completed || _txStatus == wallet::TxStatus::Confirming;
 }
 
 bool TxObject::isSelfTx() const
 {
-    return _tx.m_selfTx;
+    return hasFlag(SelfTx);
 }
 
 bool TxObject::isShieldedTx() const
 {
-    return _tx.m_txType == beam::wallet::TxType::PushTransaction;
+    return _txType == beam::wallet::TxType::PushTransaction;
 }
 
 bool TxObject::isContractTx() const
 {
-    return _tx.m_txType == beam::wallet::TxType::Contract;
+    return _txType == beam::wallet::TxType::Contract;
 }
 
 bool TxObject::isDexTx() const
 {
-    return _tx.m_txType == beam::wallet::TxType::DexSimpleSwap;
+    return _txType == beam::wallet::TxType::DexSimpleSwap;
 }
 
-QString TxObject::getAppId()
+QString TxObject::getAppId() const
 {
-    if (!_appid.is_initialized())
-    {
-        if(auto appid = _tx.GetParameter<std::string>(beam::wallet::TxParameterID::AppID))
-        {
-            _appid = QString::fromStdString(*appid);
-        }
-        else
-        {
-            _appid = "";
-        }
-    }
-    return *_appid;
+    return _appId;
 }
 
-bool TxObject::isDappTx()
+bool TxObject::isDappTx() const
 {
-    return !getAppId().isEmpty();
+    return hasFlag(DappTx);
 }
 
-beam::wallet::TxAddressType TxObject::getAddressType()
+beam::wallet::TxAddressType TxObject::getAddressType() const
 {
-    if (!_addressType)
-    {
-        _addressType = _tx.GetParameter<beam::wallet::TxAddressType>(beam::wallet::TxParameterID::AddressType);
-    }
-
-    return _addressType ? *_addressType : beam::wallet::TxAddressType::Unknown;
+    return _addressType;
 }
 
 bool TxObject::isSent() const
@@ -596,62 +723,82 @@ bool TxObject::isReceived() const
 
 bool TxObject::isCanceled() const
 {
-    return _tx.m_status == wallet::TxStatus::Canceled;
+    return _txStatus == wallet::TxStatus::Canceled;
 }
 
 bool TxObject::isFailed() const
 {
-    return _tx.m_status == wallet::TxStatus::Failed;
+    return _txStatus == wallet::TxStatus::Failed;
 }
 
 bool TxObject::isExpired() const
 {
-    return isFailed() && _tx.m_failureReason == beam::wallet::TxFailureReason::TransactionExpired;
+    return isFailed() && _failureReason == beam::wallet::TxFailureReason::TransactionExpired;
 }
 
-const std::vector<beam::Asset::ID>& TxObject::getAssetsList() const
+std::vector<beam::Asset::ID> TxObject::getAssetsList() const
 {
-    return _assetsList;
+    std::vector<beam::Asset::ID> assets;
+    assets.reserve(assetCount());
+    for (size_t i = 0; i < assetCount(); ++i)
+    {
+        assets.push_back(assetAt(i).assetId);
+    }
+    return assets;
 }
 
 bool TxObject::isFeeOnly() const
 {
-    return isContractTx() && _contractSpend.empty();
+    return hasFlag(FeeOnly);
 }
 
-const std::vector<QString>& TxObject::getAssetAmounts() const
+std::vector<QString> TxObject::getAssetAmounts() const
 {
-    return _assetAmounts;
+    std::vector<QString> amounts;
+    amounts.reserve(assetCount());
+    for (size_t i = 0; i < assetCount(); ++i)
+    {
+        amounts.push_back(AmountToUIString(assetAt(i).amount));
+    }
+    return amounts;
 }
 
-const std::vector<bool>& TxObject::getAssetAmountsIncome() const
+std::vector<bool> TxObject::getAssetAmountsIncome() const
 {
-    return _assetAmountsIncome;
+    std::vector<bool> income;
+    income.reserve(assetCount());
+    for (size_t i = 0; i < assetCount(); ++i)
+    {
+        income.push_back(assetAt(i).income);
+    }
+    return income;
 }
 
-const std::vector<QString>& TxObject::getAssetRates() const
+std::vector<QString> TxObject::getAssetRates() const
 {
-    return _assetRates;
+    std::vector<QString> rates;
+    rates.reserve(assetCount());
+    for (size_t i = 0; i < assetCount(); ++i)
+    {
+        const auto rate = assetAt(i).rate;
+        rates.push_back(rate ? AmountToUIString(rate) : "0");
+    }
+    return rates;
 }
 
-QString TxObject::getAmountSecondCurrency()
+// formatted on every call, TxObjectList caches the role value
+QString TxObject::getAmountSecondCurrency() const
 {
-    if (_amountSecondCurrency.isEmpty())
-    {
-        // TODO: support multiple assets
-        if (_assetsList.size() == 1)
-        {
-            _amountSecondCurrency = QMLGlobals::calcAmountInSecondCurrency(
-                _assetAmounts[0],
-                _assetRates[0],
-                QString::fromStdString(_secondCurrency.m_value).toUpper());
-        }
-    }
+    QString amount;
 
-    if (_amountSecondCurrency.isEmpty())
+    // TODO: support multiple assets
+    if (assetCount() == 1)
     {
-        _amountSecondCurrency = "0";
+        amount = QMLGlobals::calcAmountInSecondCurrency(
+            AmountToUIString(_asset.amount),
+            getRate(_asset.assetId),
+            _secondCurrency);
     }
 
-    return _amountSecondCurrency;
+    return amount.isEmpty() ? QString("0") : amount;
 }
@@ -13,22 +13,31 @@
 // limitations under the License.
 #pragma once
 
-#include <QObject>
+#include <QString>
 #include <QDateTime>
+#include <memory>
 #include "viewmodel/payment_item.h"
 #include "viewmodel/ui_helpers.h"
 #include "wallet/client/extensions/news_channels/interface.h"
 #include "bvm/ManagerStd.h"
 #include "model/assets_list.h"
+#include "tx_status.h"
 
-class TxObject: public QObject
+// A row of the transaction lists. Hundreds of thousands of them can be alive at once,
+// so a row keeps only the values its roles are built from: ids, addresses and amounts
+// stay binary, flags are packed and repeated strings come from StringPool. The full
+// description stays in TxStore, role values are cached by TxObjectList.
+class TxObject
 {
-    Q_OBJECT
 public:
-    explicit TxObject(beam::wallet::TxDescription tx, QObject* parent = nullptr);
-    TxObject(beam::wallet::TxDescription tx, beam::wallet::Currency secondCurrency, QObject* parent = nullptr);
+    explicit TxObject(const beam::wallet::TxDescription& tx);
+    TxObject(const beam::wallet::TxDescription& tx, const beam::wallet::Currency& secondCurrency);
+    virtual ~TxObject() = default;
     bool operator==(const TxObject& other) const;
 
+    // true for the transaction types listed in the wallet transaction history
+    static bool isHistoryTx(const beam::wallet::TxDescription& tx);
+
     beam::Timestamp timeCreated() const;
     beam::wallet::TxID getTxID() const;
     QString getAmountGeneral() const;
@@ -47,28 +56,30 @@ public:
     QString getToken() const;
     QString getSenderEndpoint() const;
     QString getReceiverIdentity() const;
+    // every field the transaction search box looks at
+    QString getSearchText() const;
     QString getFeeRate() const;
-    QString getAmountSecondCurrency();
+    QString getAmountSecondCurrency() const;
     QString getCidsStr() const;
     QString getSource() const;
     uint32_t getMinConfirmations() const;
     QString getConfirmationProgress() const;
     bool isActive() const;
-    QString getAppId();
-    bool isDappTx();
+    QString getAppId() const;
+    bool isDappTx() const;
     bool isFeeOnly() const;
 
-    const std::vector<beam::Asset::ID>& getAssetsList() const;
-    const std::vector<QString>& getAssetAmounts() const;
-    const std::vector<bool>& getAssetAmountsIncome() const;
-    const std::vector<QString>& getAssetRates() const;
+    std::vector<beam::Asset::ID> getAssetsList() const;
+    std::vector<QString> getAssetAmounts() const;
+    std::vector<bool> getAssetAmountsIncome() const;
+    std::vector<QString> getAssetRates() const;
 
     bool isIncome() const;
     bool isSelfTx() const;
     bool isShieldedTx() const;
     bool isContractTx() const;
     bool isDexTx() const;
-    beam::wallet::TxAddressType getAddressType();
+    beam::wallet::TxAddressType getAddressType() const;
     bool isSent() const;
     bool isReceived() const;
     virtual bool isCancelAvailable() const;
@@ -81,27 +92,78 @@ public:
     virtual bool isFailed() const;
     virtual bool isMultiAsset() const;
     bool canShowContractNotification() const;
+    TxUIStatus getUIStatus() const;
+    TxFilterStatus getFilterStatus() const;
 
-protected:
-    [[nodiscard]] const beam::wallet::TxDescription& getTxDescription() const;
+private:
+    enum Flag : uint16_t
+    {
+        Income              = 1 << 0,
+        FeeOnly             = 1 << 1,
+        DappTx              = 1 << 2,
+        Sender              = 1 << 3,
+        SelfTx              = 1 << 4,
+        CanCancel           = 1 << 5,
+        CanDelete           = 1 << 6,
+        NotificationRead    = 1 << 7,
+        HasAsset            = 1 << 8,
+    };
 
-    beam::wallet::TxDescription _tx;
-    uint32_t _minConfirmations = 0;
-    beam::wallet::Currency _secondCurrency;
-    QString _amountSecondCurrency;
+    // one asset moved by the transaction, the rate is the one stored with the transaction
+    struct AssetAmount
+    {
+        beam::Amount amount = 0;
+        beam::Amount rate = 0;
+        beam::Asset::ID assetId = 0;
+        bool income = false;
+    };
+
+    // heights the state details and the confirmations count from, kept for unfinished
+    // transactions and the ones waiting for confirmations only, zero when unknown
+    struct Progress
+    {
+        beam::Height peerResponseHeight = 0;
+        beam::Height maxHeight = 0;
+        beam::Height lifetime = 0;
+        beam::Height kernelProofHeight = 0;
+    };
 
-    mutable QString _kernelIDStr;
-    mutable QString _comment;
-    boost::optional<beam::wallet::TxAddressType> _addressType;
-    boost::optional<QString> _appid;
+    [[nodiscard]] bool hasFlag(Flag flag) const;
+    void setFlag(Flag flag, bool value);
+    void appendAsset(beam::Asset::ID assetId, beam::Amount amount, bool income, beam::Amount rate);
+    [[nodiscard]] const AssetAmount& assetAt(size_t index) const;
+    [[nodiscard]] size_t assetCount() const;
 
-    beam::Amount _contractFee = 0UL;
-    beam::bvm2::FundsMap _contractSpend;
-    QString _contractCids;
-    QString _source;
+    beam::wallet::TxID _txId = {};
+    beam::Merkle::Hash _kernelID = beam::Zero;
+    beam::wallet::WalletID _myAddr = beam::Zero;
+    beam::wallet::WalletID _peerAddr = beam::Zero;
+    beam::Timestamp _createTime = 0;
+    beam::Amount _amount = 0;
+    beam::Amount _fee = 0;          // with the shielded inputs fee, the full fee of a contract call
+    beam::Amount _rate = 0;         // of the transaction asset
+    beam::Amount _feeRate = 0;
 
-    std::vector<beam::Asset::ID> _assetsList;
-    std::vector<QString>         _assetAmounts;
-    std::vector<bool>            _assetAmountsIncome;
-    std::vector<QString>         _assetRates;
+    QString _comment;
+    QString _token;
+    QString _senderEndpoint;
+    QString _receiverEndpoint;
+    QString _status;                // pooled
+    QString _secondCurrency;        // pooled
+    QString _contractCids;          // pooled
+    QString _source;                // pooled
+    QString _appId;                 // pooled
+
+    AssetAmount _asset;                     // the first one, every transaction has it
+    std::vector<AssetAmount> _moreAssets;   // contract calls and DEX swaps only
+    std::unique_ptr<const Progress> _progress;
+
+    beam::Asset::ID _assetId = 0;
+    uint32_t _minConfirmations = 0;
+    beam::wallet::TxStatus _txStatus = beam::wallet::TxStatus::Pending;
+    beam::wallet::TxFailureReason _failureReason = beam::wallet::TxFailureReason::Unknown;
+    beam::wallet::TxType _txType = beam::wallet::TxType::Simple;
+    beam::wallet::TxAddressType _addressType = beam::wallet::TxAddressType::Unknown;
+    TxUIStatus _uiStatus = TxUIStatus::Unknown;
+    uint16_t _flags = 0;
 };
@@ -15,216 +15,36 @@
 #include "tx_object_list.h"
 #include "model/app_model.h"
 #include "viewmodel/qml_globals.h"
+#include "viewmodel/helpers/string_pool.h"
+#include "tx_status.h"
+#include "utility/logger.h"
 
 namespace
 {
-QString getStatusTextTranslated(const QString& status, beam::wallet::TxAddressType addressType)
+constexpr int kAssetInfoDelayMs = 100;
+constexpr int kCacheStatsIntervalMs = 60 * 1000;
+
+constexpr int kRoleCacheSize = 16 * 1024;
+
+// roles which are expensive to build and do not depend on the current height
+constexpr TxObjectList::Roles kCachedRoles[] =
 {
-    if (status == "pending")
-    {
-        //% "pending"
-        return qtTrId("wallet-txs-status-pending");
-    }
-    else if (status == "waiting for sender")
-    {
-        //% "waiting for sender"
-        return qtTrId("wallet-txs-status-waiting-sender");
-    }
-    else if (status == "waiting for receiver")
-    {
-        if (addressType != beam::wallet::TxAddressType::Offline)
-        {
-            //% "waiting for receiver"
-            return qtTrId("wallet-txs-status-waiting-receiver");
-        }
-        else
-        {
-            /*% "waiting for receiver
-(offline)"*/
-            return qtTrId("wallet-txs-status-waiting-receiver-offline");
-        }
-    }
-    else if (status == "in progress")
-    {
-        //% "in progress"
-        return qtTrId("wallet-txs-status-in-progress");
-    }
-    else if (status == "sent to own address")
-    {
-        //% "sent to own address"
-        return qtTrId("wallet-txs-status-own-sent");
-    }
-    else if (status == "sending to own address")
-    {
-        //% "sending to own address"
-        return qtTrId("wallet-txs-status-own-sending");
-    }
-    else if (status == "received")
-    {
-        //% "received"
-        return qtTrId("wallet-txs-status-received");
-    }
-    else if (status == "sent")
-    {
-        //% "sent"
-        return qtTrId("wallet-txs-status-sent");
-    }
-    else if (status == "cancelled")
-    {
-        //% "canceled"
-        return qtTrId("wallet-txs-status-cancelled");
-    }
-    else if (status == "expired")
-    {
-        //% "expired"
-        return qtTrId("wallet-txs-status-expired");
-    }
-    else if (status == "failed")
-    {
-        //% "failed"
-        return qtTrId("wallet-txs-status-failed");
-    }
-    // in progress
-    else if (status == "in progress maximum anonymity")
-    {
-        /*% "in progress
-(maximum anonymity)" */
-        return qtTrId("wallet-txs-status-in-progress-max");
-    }
-    else if (status == "sending maximum anonymity to own address")
-    {
-        /*% "sending to own address
-(maximum anonymity)" */
-        return qtTrId("wallet-txs-status-in-progress-max-to-own");
-    }
-    else if (status == "in progress offline")
-    {
-        /*% "in progress (offline)" */
-        return qtTrId("wallet-txs-status-in-progress-max-offline");
-    }
-    else if (status == "in progress public offline")
-    {
-        /*% "in progress
-(public offline)" */
-        return qtTrId("wallet-txs-status-in-progress-public-offline");
-    }
-    else if (status == "sending offline to own address")
-    {
-        /*% "sending to own address
-(offline)" */
-        return qtTrId("wallet-txs-status-in-progress-offline-to-own");
-    }
-    else if (status == "sending public offline to own address")
-    {
-        /*% "sending to own address
-(public offline)" */
-        return qtTrId("wallet-txs-status-in-progress-pub-offline-to-own");
-    }
-    // sent
-    else if (status == "sent maximum anonymity")
-    {
-        /*% "sent
-(maximum anonymity)"*/
-        return qtTrId("wallet-txs-status-sent-max");
-    }
-    else if (status == "sent offline")
-    {
-        /*% "sent (offline)" */
-        return qtTrId("wallet-txs-status-sent-max-offline");
-    }
-    else if (status == "sent public offline")
-    {
-        /*% "sent
-(public offline)" */
-        return qtTrId("wallet-txs-status-sent-public-offline");
-    }
-    else if (status == "sent maximum anonymity to own address")
-    {
-        /*% "sent to own address
-(maximum anonymity)" */
-        return qtTrId("wallet-txs-status-sent-max-to-own");
-    }
-    else if (status == "sent offline to own address")
-    {
-        /*% "sent to own address
-(offline)" */
-        return qtTrId("wallet-txs-status-sent-offline-to-own");
-    }
-    else if (status == "sent public offline to own address")
-    {
-        /*% "sent to own address
-(public offline)" */
-        return qtTrId("wallet-txs-status-sent-pub-offline-to-own");
-    }
-    // received
-    else if (status == "received maximum anonymity")
-    {
-        /*% "received
-(maximum anonymity)" */
-        return qtTrId("wallet-txs-status-received-max");
-    }
-    else if (status == "received offline")
-    {
-        /*% "received (offline)" */
-        return qtTrId("wallet-txs-status-received-max-offline");
-    }
-    else if (status == "received public offline")
-    {
-        /*% "received
-(public offline)" */
-        return qtTrId("wallet-txs-status-received-public-offline");
-    }
-    // canceled
-    else if (status == "canceled maximum anonymity")
-    {
-        /*% "canceled
-(maximum anonymity)" */
-        return qtTrId("wallet-txs-status-canceled-max");
-    }
-    else if (status == "canceled offline")
-    {
-        /*% "canceled (offline)" */
-        return qtTrId("wallet-txs-status-canceled-max-offline");
-    }
-    else if (status == "canceled public offline")
-    {
-        /*% "canceled
-(public offline)" */
-        return qtTrId("wallet-txs-status-canceled-public-offline");
-    }
-    // failed
-    else if (status == "failed maximum anonymity")
-    {
-        /*% "failed
-(maximum anonymity)" */
-        return qtTrId("wallet-txs-status-failed-max");
-    }
-    else if (status == "failed offline")
-    {
-        /*% "failed (offline)" */
-        return qtTrId("wallet-txs-status-failed-max-offline");
-    }
-    else if (status == "failed public offline")
-    {
-        /*% "failed
-(public offline)" */
-        return qtTrId("wallet-txs-status-failed-public-offline");
-    }
-    else if (status == "completed")
-    {
-        //% "completed"
-        return qtTrId("wallet-txs-status-completed");
-    }
-    else if (status == "confirming")
-    {
-        //% "confirming"
-        return qtTrId("wallet-txs-status-confirming");
-    }
-    else
-    {
-        //% "unknown"
-        return qtTrId("wallet-txs-status-unknown");
-    }
+    TxObjectList::Roles::TimeCreated,
+    TxObjectList::Roles::AmountGeneralSort,
+    TxObjectList::Roles::AmountSecondCurrency,
+    TxObjectList::Roles::AmountSecondCurrencySort,
+    TxObjectList::Roles::TxID,
+    TxObjectList::Roles::Search,
+    TxObjectList::Roles::AssetNames,
+    TxObjectList::Roles::AssetNamesSort,
+    TxObjectList::Roles::AssetVerified,
+    TxObjectList::Roles::AssetIcons,
+    TxObjectList::Roles::AssetFilter,
+};
+
+bool isCachedRole(TxObjectList::Roles role)
+{
+    return std::find(std::begin(kCachedRoles), std::end(kCachedRoles), role) != std::end(kCachedRoles);
 }
 
 }  // namespace
@@ -232,7 +52,16 @@ QString getStatusTextTranslated(const QString& status, beam::wallet::TxAddressTy
 TxObjectList::TxObjectList()
     : _amgr(AppModel::getInstance().getAssets())
 {
+    _assetInfoTimer.setSingleShot(true);
+    _assetInfoTimer.setInterval(kAssetInfoDelayMs);
+    connect(&_assetInfoTimer, &QTimer::timeout, this, &TxObjectList::updateAssetRows);
     connect(_amgr.get(), &AssetsManager::assetInfo, this, &TxObjectList::onAssetInfo);
+
+    _roleCache.setMaxCost(kRoleCacheSize);
+
+    _cacheStatsTimer.setInterval(kCacheStatsIntervalMs);
+    connect(&_cacheStatsTimer, &QTimer::timeout, this, &TxObjectList::logCacheStats);
+    _cacheStatsTimer.start();
 }
 
 QHash<int, QByteArray> TxObjectList::roleNames() const
@@ -314,9 +143,95 @@ QVariant TxObjectList::data(const QModelIndex &index, int role) const
     {
        return QVariant();
     }
-    
+
     auto& value = m_list[index.row()];
-    switch (static_cast<Roles>(role))
+    if (!isCachedRole(static_cast<Roles>(role)))
+    {
+        return getRoleValue(value, static_cast<Roles>(role));
+    }
+
+    const RoleKey key{value->getTxID(), role};
+    if (const auto* cached = _roleCache.object(key))
+    {
+        ++_cacheHits;
+        return *cached;
+    }
+
+    ++_cacheMisses;
+    auto result = getRoleValue(value, static_cast<Roles>(role));
+    _roleCache.insert(key, new QVariant(result));
+    return result;
+}
+
+void TxObjectList::invalidateRates()
+{
+    static const QVector<int> kRateRoles =
+    {
+        static_cast<int>(Roles::Rate),
+        static_cast<int>(Roles::FeeRate),
+        static_cast<int>(Roles::AmountSecondCurrency),
+        static_cast<int>(Roles::AmountSecondCurrencySort),
+        static_cast<int>(Roles::AssetRates),
+    };
+    dropCachedRoles(kRateRoles);
+    touch(0, m_list.size() - 1, kRateRoles);
+}
+
+void TxObjectList::dropCachedRoles(const beam::wallet::TxID& txId)
+{
+    for (auto role : kCachedRoles)
+    {
+        _roleCache.remove({txId, static_cast<int>(role)});
+    }
+}
+
+void TxObjectList::dropCachedRoles(const beam::wallet::TxID& txId, const QVector<int>& roles)
+{
+    for (auto role : roles)
+    {
+        _roleCache.remove({txId, role});
+    }
+}
+
+void TxObjectList::dropCachedRoles(const QVector<int>& roles)
+{
+    const auto keys = _roleCache.keys();
+    for (const auto& key : keys)
+    {
+        if (roles.contains(key.role))
+        {
+            _roleCache.remove(key);
+        }
+    }
+}
+
+quint64 TxObjectList::getCacheHits() const
+{
+    return _cacheHits;
+}
+
+quint64 TxObjectList::getCacheMisses() const
+{
+    return _cacheMisses;
+}
+
+// logged only when the views read something since the last time
+void TxObjectList::logCacheStats()
+{
+    const auto lookups = _cacheHits + _cacheMisses;
+    if (lookups == _loggedLookups)
+    {
+        return;
+    }
+    _loggedLookups = lookups;
+
+    BEAM_LOG_DEBUG() << "transactions role cache: " << _cacheHits << " hits, " << _cacheMisses << " misses, "
+                     << (_cacheHits * 100 / lookups) << "% hit rate";
+}
+
+QVariant TxObjectList::getRoleValue(const std::shared_ptr<TxObject>& value, Roles role) const
+{
+    switch (role)
     {
         case Roles::IsFeeOnly:
             return value->isFeeOnly();
@@ -347,10 +262,14 @@ QVariant TxObjectList::data(const QModelIndex &index, int role) const
         case Roles::AddressTo:
             return value->getAddressTo();
         case Roles::Status:
+        {
+            const auto& status = beamui::getTxUIStatusText(value->getUIStatus());
+            return value->getUIStatus() == TxUIStatus::Confirming
+                ? status + " (" + value->getConfirmationProgress() + ")"
+                : status;
+        }
         case Roles::StatusSort:
-            return value->getStatus() == "confirming"
-                ? getStatusTextTranslated(value->getStatus(), value->getAddressType()) + " (" + value->getConfirmationProgress() + ")"
-                : getStatusTextTranslated(value->getStatus(), value->getAddressType());
+            return static_cast<int>(value->getUIStatus());
         case Roles::Fee:
             return value->getFee();
         case Roles::Comment:
@@ -404,24 +323,7 @@ QVariant TxObjectList::data(const QModelIndex &index, int role) const
         case Roles::RawTxID:
             return QVariant::fromValue(value->getTxID());
         case Roles::Search: 
-        {
-            QString r = value->getTransactionID();
-            r.append(" ");
-            r.append(value->getKernelID());
-            r.append(" ");
-            r.append(value->getAddressFrom());
-            r.append(" ");
-            r.append(value->getAddressTo());
-            r.append(" ");
-            r.append(value->getComment());
-            r.append(" ");
-            r.append(value->getSenderEndpoint());
-            r.append(" ");
-            r.append(value->getReceiverIdentity());
-            r.append(" ");
-            r.append(value->getToken());
-            return r;
-        }
+            return value->getSearchText();
         case Roles::StateDetails:
             return value->getStateDetails();
         case Roles::Token:
@@ -442,7 +344,7 @@ QVariant TxObjectList::data(const QModelIndex &index, int role) const
                 }
                 names += _amgr->getUnitName(assetID, AssetsManager::NoShorten);
             }
-            return names;
+            return StringPool::intern(names);
         }
         case Roles::AssetNames:
         {
@@ -450,7 +352,7 @@ QVariant TxObjectList::data(const QModelIndex &index, int role) const
             const auto& alist = value->getAssetsList();
             for(const auto& assetID: alist)
             {
-               namesList.append(_amgr->getUnitName(assetID, AssetsManager::NoShorten));
+               namesList.append(StringPool::intern(_amgr->getUnitName(assetID, AssetsManager::NoShorten)));
             }
             QVariant result;
             result.setValue(namesList);
@@ -474,7 +376,7 @@ QVariant TxObjectList::data(const QModelIndex &index, int role) const
             const auto& alist = value->getAssetsList();
             for(const auto& assetID: alist)
             {
-                iconsList.append(_amgr->getIcon(assetID));
+                iconsList.append(StringPool::intern(_amgr->getIcon(assetID)));
             }
             QVariant result;
             result.setValue(iconsList);
@@ -520,7 +422,7 @@ QVariant TxObjectList::data(const QModelIndex &index, int role) const
                 r += QString::number(aid);
             }
 
-            return r;
+            return StringPool::intern(r);
         }
         case Roles::AmountSecondCurrencySort:
             return static_cast<qulonglong>(beamui::UIStringToAmount(value->getAmountSecondCurrency()));
@@ -542,41 +444,104 @@ QVariant TxObjectList::data(const QModelIndex &index, int role) const
             return value->isActive();
         case Roles::FilterStatus:
         {
-            if (value->isInProgress())
-            {
-                return "inProgress";
-            }
-
-            if (value->isCompleted())
+            switch (value->getFilterStatus())
             {
-                return "completed";
+                case TxFilterStatus::InProgress:
+                    return "inProgress";
+                case TxFilterStatus::Completed:
+                    return "completed";
+                case TxFilterStatus::Canceled:
+                    return "canceled";
+                case TxFilterStatus::Failed:
+                    return "failed";
+                default:
+                    return "unknown";
             }
-
-            if (value->isCanceled())
-            {
-                return "canceled";
-            }
-
-            if (value->isFailed())
-            {
-                return "failed";
-            }
-            return "unknown";
         }
         default:
             return QVariant();
     }
 }
 
+beam::wallet::TxID TxObjectList::keyOf(const std::shared_ptr<TxObject>& item) const
+{
+    return item->getTxID();
+}
+
+bool TxObjectList::matchesRow(int row, int role, const QString& text, bool& matches) const
+{
+    if (role != static_cast<int>(Roles::Search) || row < 0 || row >= m_list.size())
+    {
+        return false;
+    }
+
+    matches = _searchIndex.matches(m_list[row]->getTxID(), text);
+    return true;
+}
+
+void TxObjectList::onItemAdded(const std::shared_ptr<TxObject>& item)
+{
+    _searchIndex.set(item->getTxID(), item->getSearchText());
+    for (auto assetId : item->getAssetsList())
+    {
+        _assetRows.add(assetId, item->getTxID());
+    }
+}
+
+void TxObjectList::onItemRemoved(const std::shared_ptr<TxObject>& item)
+{
+    dropCachedRoles(item->getTxID());
+    _searchIndex.remove(item->getTxID());
+    for (auto assetId : item->getAssetsList())
+    {
+        _assetRows.remove(assetId, item->getTxID());
+    }
+}
+
+void TxObjectList::onItemsCleared()
+{
+    _roleCache.clear();
+    _searchIndex.clear();
+    _assetRows.clear();
+}
+
 void TxObjectList::onAssetInfo(beam::Asset::ID assetId)
 {
-    for (auto it = m_list.begin(); it != m_list.end(); ++it)
+    _changedAssets.insert(assetId);
+
+    // not restarted, a steady stream of asset info still gets shown
+    if (!_assetInfoTimer.isActive())
     {
-        const auto& alist = (*it)->getAssetsList();
-        if(std::find(alist.begin(), alist.end(), assetId) != alist.end())
-        {
-            const auto idx = it - m_list.begin();
-            ListModel::touch(idx);
-        }
+        _assetInfoTimer.start();
+    }
+}
+
+void TxObjectList::updateAssetRows()
+{
+    std::vector<int> rows;
+    for (auto assetId : _changedAssets)
+    {
+        _assetRows.collectRows(assetId, *this, rows);
+    }
+    _changedAssets.clear();
+
+    // a multi-asset transaction is found once per asset
+    std::sort(rows.begin(), rows.end());
+    rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+
+    static const QVector<int> kAssetRoles =
+    {
+        static_cast<int>(Roles::AssetNames),
+        static_cast<int>(Roles::AssetNamesSort),
+        static_cast<int>(Roles::AssetVerified),
+        static_cast<int>(Roles::AssetIcons),
+        static_cast<int>(Roles::AssetRates),
+    };
+
+    // the rest of the row did not change, its cached values stay
+    for (auto row : rows)
+    {
+        dropCachedRoles(m_list[row]->getTxID(), kAssetRoles);
     }
+    touchRanges(rows, kAssetRoles);
 }
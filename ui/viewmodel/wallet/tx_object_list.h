@@ -15,11 +15,17 @@
 #pragma once
 
 #include "tx_object.h"
-#include "viewmodel/helpers/list_model.h"
+#include "viewmodel/helpers/keyed_list_model.h"
+#include "viewmodel/helpers/asset_rows_index.h"
+#include "viewmodel/helpers/searchable_model.h"
+#include "viewmodel/helpers/substring_index.h"
 #include "model/assets_manager.h"
+#include <QCache>
 #include <QLocale>
+#include <QTimer>
+#include <set>
 
-class TxObjectList : public ListModel<std::shared_ptr<TxObject>>
+class TxObjectList : public KeyedListModel<std::shared_ptr<TxObject>, beam::wallet::TxID>, public SearchableModel
 {
     Q_OBJECT
 public:
@@ -98,10 +104,61 @@ public:
     [[nodiscard]] QVariant data(const QModelIndex &index, int role) const override;
     [[nodiscard]] QHash<int, QByteArray> roleNames() const override;
 
+    // drops the cached values built from exchange rates and refreshes those roles
+    void invalidateRates();
+    [[nodiscard]] quint64 getCacheHits() const;
+    [[nodiscard]] quint64 getCacheMisses() const;
+
+    // answers the "search" role from the substring index
+    bool matchesRow(int row, int role, const QString& text, bool& matches) const override;
+
+protected:
+    beam::wallet::TxID keyOf(const std::shared_ptr<TxObject>& item) const override;
+    void onItemAdded(const std::shared_ptr<TxObject>& item) override;
+    void onItemRemoved(const std::shared_ptr<TxObject>& item) override;
+    void onItemsCleared() override;
+
 private slots:
     void onAssetInfo(beam::Asset::ID assetId);
+    void updateAssetRows();
+    void logCacheStats();
 
 private:
+    // a cached role value, keyed by the transaction so a replaced row cannot see the old values
+    struct RoleKey
+    {
+        beam::wallet::TxID txId;
+        int role;
+
+        bool operator==(const RoleKey& other) const
+        {
+            return role == other.role && txId == other.txId;
+        }
+
+        friend uint qHash(const RoleKey& key, uint seed = 0)
+        {
+            return qHashBits(key.txId.data(), key.txId.size(), seed ^ static_cast<uint>(key.role));
+        }
+    };
+
+    [[nodiscard]] QVariant getRoleValue(const std::shared_ptr<TxObject>& value, Roles role) const;
+    void dropCachedRoles(const beam::wallet::TxID& txId);
+    void dropCachedRoles(const beam::wallet::TxID& txId, const QVector<int>& roles);
+    void dropCachedRoles(const QVector<int>& roles);
+
     AssetsManager::Ptr _amgr;
     QLocale m_locale;
+    SubstringIndex<beam::wallet::TxID> _searchIndex;
+    AssetRowsIndex<beam::wallet::TxID> _assetRows;
+
+    // asset info arrives in bursts, rows are updated once per burst
+    std::set<beam::Asset::ID> _changedAssets;
+    QTimer _assetInfoTimer;
+
+    // values of the rows the views read lately, bounded whatever the size of the list is
+    mutable QCache<RoleKey, QVariant> _roleCache;
+    mutable quint64 _cacheHits = 0;
+    mutable quint64 _cacheMisses = 0;
+    quint64 _loggedLookups = 0;
+    QTimer _cacheStatsTimer;
 };
@@ -0,0 +1,207 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "tx_object_loader.h"
+#include <algorithm>
+#include <cassert>
+#include "utility/logger.h"
+#include "viewmodel/helpers/row_pool.h"
+
+namespace
+{
+    // small changes are cheaper to convert in place than to schedule
+    constexpr size_t kMinParallelSize = 256;
+    constexpr size_t kChunkSize = 512;
+}
+
+TxObjectLoader::TxObjectLoader(TxObjectList& list, QObject* parent)
+    : QObject(parent)
+    , _list(list)
+{
+}
+
+TxObjectLoader::~TxObjectLoader()
+{
+    _cancelledBefore = _nextChangeId;
+    _pool.waitForDone();
+}
+
+void TxObjectLoader::load(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items, beam::wallet::Currency secondCurrency)
+{
+    using namespace beam::wallet;
+
+    const auto changeId = _nextChangeId++;
+
+    if (action == ChangeAction::Reset)
+    {
+        // a reset replaces everything, changes still being converted are of no use
+        _cancelledBefore = changeId;
+        _changes.clear();
+        RowPool<TxObject>::nextGeneration();
+        _done = 0;
+        _total = 0;
+    }
+
+    if (_changes.empty() && items.size() < kMinParallelSize)
+    {
+        Change change;
+        change.id = changeId;
+        change.action = action;
+        apply(change, convert(std::vector<TxDescription>(items), secondCurrency));
+        emit changeApplied(action);
+        return;
+    }
+
+    auto& change = _changes.emplace_back();
+    change.id = changeId;
+    change.action = action;
+    change.chunksLeft = std::max<size_t>(1, (items.size() + kChunkSize - 1) / kChunkSize);
+    _total += static_cast<int>(items.size());
+
+    for (size_t first = 0; first < items.size() || first == 0; first += kChunkSize)
+    {
+        const auto last = std::min(items.size(), first + kChunkSize);
+        std::vector<TxDescription> chunk(items.begin() + first, items.begin() + last);
+
+        _pool.start(QRunnable::create([this, changeId, chunk = std::move(chunk), secondCurrency]() mutable
+        {
+            if (changeId < _cancelledBefore)
+            {
+                return;
+            }
+
+            const int count = static_cast<int>(chunk.size());
+            auto objects = convert(std::move(chunk), secondCurrency);
+            QMetaObject::invokeMethod(this, [this, changeId, objects = std::move(objects), count]() mutable
+            {
+                onChunkConverted(changeId, std::move(objects), count);
+            }, Qt::QueuedConnection);
+        }));
+
+        if (last == items.size())
+        {
+            break;
+        }
+    }
+
+    emit progress(_done, _total);
+}
+
+bool TxObjectLoader::isLoading() const
+{
+    return !_changes.empty();
+}
+
+TxObjectLoader::Objects TxObjectLoader::convert(std::vector<beam::wallet::TxDescription>&& items, beam::wallet::Currency secondCurrency)
+{
+    Objects objects;
+    objects.reserve(items.size());
+    for (auto& tx : items)
+    {
+        if (!TxObject::isHistoryTx(tx))
+        {
+            continue;
+        }
+
+        try
+        {
+            objects.push_back(RowPool<TxObject>::make(std::move(tx), secondCurrency));
+        }
+        catch (const std::runtime_error& err)
+        {
+            BEAM_LOG_ERROR() << err.what();
+        }
+    }
+    return objects;
+}
+
+void TxObjectLoader::onChunkConverted(uint64_t changeId, Objects&& objects, int count)
+{
+    auto it = std::find_if(_changes.begin(), _changes.end(), [changeId](const auto& change) { return change.id == changeId; });
+    if (it == _changes.end())
+    {
+        return;
+    }
+
+    it->converted.push_back(std::move(objects));
+    --it->chunksLeft;
+    _done += count;
+
+    applyConverted();
+    emit progress(_done, _total);
+}
+
+void TxObjectLoader::applyConverted()
+{
+    // chunks of a change go in as they come, a later change waits for the earlier ones
+    while (!_changes.empty())
+    {
+        auto& change = _changes.front();
+        for (auto& objects : change.converted)
+        {
+            apply(change, std::move(objects));
+        }
+        change.converted.clear();
+
+        if (change.chunksLeft > 0)
+        {
+            break;
+        }
+
+        const auto action = change.action;
+        _changes.pop_front();
+        emit changeApplied(action);
+    }
+
+    if (_changes.empty())
+    {
+        _done = 0;
+        _total = 0;
+    }
+}
+
+void TxObjectLoader::apply(Change& change, Objects&& objects)
+{
+    using namespace beam::wallet;
+
+    switch (change.action)
+    {
+        case ChangeAction::Reset:
+            if (!change.listReset)
+            {
+                change.listReset = true;
+                _list.reset(std::move(objects));
+            }
+            else
+            {
+                _list.insert(objects);
+            }
+            break;
+
+        case ChangeAction::Removed:
+            _list.remove(objects);
+            break;
+
+        case ChangeAction::Added:
+            _list.insert(objects);
+            break;
+
+        case ChangeAction::Updated:
+            _list.update(objects);
+            break;
+
+        default:
+            assert(false && "Unexpected action");
+            break;
+    }
+}
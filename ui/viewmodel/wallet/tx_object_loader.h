@@ -0,0 +1,69 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QObject>
+#include <QThreadPool>
+#include <atomic>
+#include <deque>
+#include "tx_object_list.h"
+
+// Converts wallet transaction descriptions into TxObject rows off the UI thread.
+// Large changes are split into chunks converted in parallel, finished chunks are
+// applied to the list on the UI thread in the order the changes came in, so the
+// view fills up while a big reset is still being converted.
+class TxObjectLoader : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TxObjectLoader(TxObjectList& list, QObject* parent = nullptr);
+    ~TxObjectLoader() override;
+
+    void load(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items, beam::wallet::Currency secondCurrency);
+
+    [[nodiscard]] bool isLoading() const;
+
+signals:
+    // rows of the pending changes converted so far
+    void progress(int done, int total);
+    void changeApplied(beam::wallet::ChangeAction action);
+
+private:
+    using Objects = std::vector<std::shared_ptr<TxObject>>;
+
+    struct Change
+    {
+        uint64_t id = 0;
+        beam::wallet::ChangeAction action = beam::wallet::ChangeAction::Reset;
+        size_t chunksLeft = 0;
+        bool listReset = false;
+        std::vector<Objects> converted;
+    };
+
+    static Objects convert(std::vector<beam::wallet::TxDescription>&& items, beam::wallet::Currency secondCurrency);
+
+    void onChunkConverted(uint64_t changeId, Objects&& objects, int count);
+    void applyConverted();
+    void apply(Change& change, Objects&& objects);
+
+    TxObjectList& _list;
+    QThreadPool _pool;
+
+    std::deque<Change> _changes;
+    uint64_t _nextChangeId = 1;
+    std::atomic<uint64_t> _cancelledBefore = 0;  // changes older than the last reset are dropped
+
+    int _done = 0;
+    int _total = 0;
+};
@@ -0,0 +1,1043 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "tx_paged_list.h"
+#include <algorithm>
+#include <atomic>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <QPointer>
+#include "model/app_model.h"
+#include "viewmodel/helpers/row_pool.h"
+#include "viewmodel/helpers/string_pool.h"
+#include "tx_filter_model.h"
+#include "utility/logger.h"
+
+namespace
+{
+    constexpr int kPageSize = 100;
+    constexpr int kPrefetch = 50;
+    constexpr int kScanChunk = 1000;
+    constexpr int kRequestDelayMs = 50;
+    constexpr int kProgressIntervalMs = 200;
+
+    using Roles = TxObjectList::Roles;
+    using TxIDSet = std::unordered_set<beam::wallet::TxID, ListModelKeyHash>;
+
+    // the values of a transaction the list filters and sorts by, all of them are taken
+    // from TxObject so the list agrees with the other transaction views
+    struct Entry
+    {
+        enum Flag : uint8_t
+        {
+            HasAsset    = 1 << 0,
+            Dex         = 1 << 1,
+            Dapp        = 1 << 2,
+            InProgress  = 1 << 3,
+            Sent        = 1 << 4,
+            Received    = 1 << 5,
+            Active      = 1 << 6,
+        };
+
+        explicit Entry(const TxObject& tx)
+            : txId(tx.getTxID())
+            , time(tx.timeCreated())
+            , amount(beamui::UIStringToAmount(tx.getAmountGeneral()))
+            , secondAmount(beamui::UIStringToAmount(tx.getAmountSecondCurrency()))
+            , source(tx.getSource())
+            , action(tx.isContractTx() ? StringPool::intern(tx.getComment()) : QString())
+            , appId(tx.isDappTx() ? tx.getAppId() : QString())
+            , status(tx.getFilterStatus())
+            , uiStatus(tx.getUIStatus())
+        {
+            const auto assets = tx.getAssetsList();
+            if (!assets.empty())
+            {
+                flags |= HasAsset;
+                assetId = assets.front();
+                moreAssets.assign(assets.begin() + 1, assets.end());
+            }
+
+            flags |= tx.isDexTx() ? Dex : 0;
+            flags |= tx.isDappTx() ? Dapp : 0;
+            flags |= tx.isInProgress() ? InProgress : 0;
+            flags |= tx.isSent() ? Sent : 0;
+            flags |= tx.isReceived() ? Received : 0;
+            flags |= tx.isActive() ? Active : 0;
+        }
+
+        [[nodiscard]] bool has(Flag flag) const
+        {
+            return (flags & flag) != 0;
+        }
+
+        [[nodiscard]] std::vector<beam::Asset::ID> getAssets() const
+        {
+            std::vector<beam::Asset::ID> assets;
+            if (has(HasAsset))
+            {
+                assets.push_back(assetId);
+                assets.insert(assets.end(), moreAssets.begin(), moreAssets.end());
+            }
+            return assets;
+        }
+
+        beam::wallet::TxID txId;
+        beam::Timestamp time;
+        beam::Amount amount;            // amountGeneralSort
+        beam::Amount secondAmount;      // amountSecondCurrencySort
+        QString source;                 // pooled
+        QString action;                 // pooled
+        QString appId;                  // pooled
+        std::vector<beam::Asset::ID> moreAssets;
+        beam::Asset::ID assetId = 0;
+        TxFilterStatus status;
+        TxUIStatus uiStatus;
+        uint8_t flags = 0;
+    };
+
+    // a history transaction as the views see it, skipped if it cannot be shown
+    template <typename Func>
+    void withTxObject(const beam::wallet::TxDescription& tx, const beam::wallet::Currency& currency, Func&& func)
+    {
+        if (!TxObject::isHistoryTx(tx))
+        {
+            return;
+        }
+
+        try
+        {
+            const TxObject object(tx, currency);
+            func(object);
+        }
+        catch (const std::runtime_error& err)
+        {
+            BEAM_LOG_ERROR() << err.what();
+        }
+    }
+
+    // the same checks as TxFilterModel::acceptsRow, the search text is matched by the caller
+    bool matchesCriteria(const TxPagedList::Query& query, const Entry& entry)
+    {
+        if (!query.statusVisible[static_cast<size_t>(entry.status)])
+        {
+            return false;
+        }
+
+        if (query.dexOnly && !entry.has(Entry::Dex))
+        {
+            return false;
+        }
+
+        if (!query.dappFilter.isEmpty())
+        {
+            if (!entry.has(Entry::Dapp))
+            {
+                return false;
+            }
+
+            if (query.dappFilter != TxFilterModel::kAllDapps && entry.appId.compare(query.dappFilter, Qt::CaseInsensitive) != 0)
+            {
+                return false;
+            }
+        }
+
+        if (!query.assets.empty())
+        {
+            const auto assets = entry.getAssets();
+            auto found = std::any_of(assets.begin(), assets.end(), [&query](beam::Asset::ID assetId)
+            {
+                return std::binary_search(query.assets.begin(), query.assets.end(), assetId);
+            });
+
+            if (!found)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // the tabs of the view
+    bool matchesFilterRole(const TxPagedList::Query& query, const Entry& entry)
+    {
+        if (!query.filterRole)
+        {
+            return true;
+        }
+
+        switch (*query.filterRole)
+        {
+            case Roles::IsInProgress:
+                return entry.has(Entry::InProgress);
+            case Roles::IsSent:
+                return entry.has(Entry::Sent);
+            case Roles::IsReceived:
+                return entry.has(Entry::Received);
+            default:
+                return true;
+        }
+    }
+
+    // criteria which select the rows, the sorting aside
+    bool sameCriteria(const TxPagedList::Query& left, const TxPagedList::Query& right)
+    {
+        return left.statusVisible == right.statusVisible
+            && left.assets == right.assets
+            && left.dexOnly == right.dexOnly
+            && left.dappFilter == right.dappFilter
+            && left.searchText == right.searchText
+            && left.filterRole == right.filterRole;
+    }
+}
+
+// Shared with the calls queued to the wallet thread, the index is only touched there.
+struct TxPagedList::Backend
+{
+    // a row of the current query with its sort key, text keys are case folded as
+    // SortFilterProxyModel compares them
+    struct Row
+    {
+        uint64_t number = 0;
+        QString text;
+        const Entry* entry = nullptr;
+    };
+
+    explicit Backend(beam::wallet::IWalletDB::Ptr db)
+        : walletDB(std::move(db))
+        , currency(beam::wallet::Currency::UNKNOWN())
+    {
+    }
+
+    [[nodiscard]] bool isCancelled(uint64_t requestId) const
+    {
+        return latestRequest != requestId;
+    }
+
+    // reads the whole history, done once and again after a reset or a new second currency only
+    bool build(const beam::wallet::Currency& secondCurrency, uint64_t requestId)
+    {
+        built = false;
+        query.reset();
+        rows.clear();
+        entries.clear();
+        assets.clear();
+        textMatches.clear();
+        matchedText.clear();
+        currency = secondCurrency;
+        scanned = 0;
+
+        for (uint64_t start = 0;; start += kScanChunk)
+        {
+            if (isCancelled(requestId))
+            {
+                entries.clear();
+                return false;
+            }
+
+            auto chunk = walletDB->getTxHistory(beam::wallet::TxType::ALL, start, kScanChunk);
+            for (const auto& tx : chunk)
+            {
+                add(tx);
+            }
+            scanned += static_cast<int>(chunk.size());
+
+            if (chunk.size() < static_cast<size_t>(kScanChunk))
+            {
+                break;
+            }
+        }
+
+        built = true;
+        return true;
+    }
+
+    void add(const beam::wallet::TxDescription& tx)
+    {
+        withTxObject(tx, currency, [this](const TxObject& object)
+        {
+            insert(object);
+        });
+    }
+
+    const Entry& insert(const TxObject& object)
+    {
+        const auto& entry = entries.insert_or_assign(object.getTxID(), Entry(object)).first->second;
+        if (entry.has(Entry::HasAsset))
+        {
+            assets.insert(entry.assetId);
+            assets.insert(entry.moreAssets.begin(), entry.moreAssets.end());
+        }
+        return entry;
+    }
+
+    // a delta of the history, the rows of the changed transactions are replaced in place
+    void apply(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items)
+    {
+        using namespace beam::wallet;
+
+        // a build which did not finish reads the changes from the DB anyway
+        if (!built)
+        {
+            return;
+        }
+
+        TxIDSet changed;
+        for (const auto& tx : items)
+        {
+            changed.insert(tx.m_txId);
+        }
+
+        if (query)
+        {
+            rows.erase(std::remove_if(rows.begin(), rows.end(), [&changed](const Row& row)
+            {
+                return changed.count(row.entry->txId) > 0;
+            }), rows.end());
+        }
+
+        for (const auto& txId : changed)
+        {
+            entries.erase(txId);
+            textMatches.erase(txId);
+        }
+
+        if (action != ChangeAction::Removed)
+        {
+            std::vector<Row> added;
+            for (const auto& tx : items)
+            {
+                withTxObject(tx, currency, [this, &added](const TxObject& object)
+                {
+                    const auto& entry = insert(object);
+                    if (!matchedText.isEmpty() && object.getSearchText().toCaseFolded().contains(matchedText))
+                    {
+                        textMatches.insert(entry.txId);
+                    }
+
+                    if (query && accepts(*query, entry) && matchesFilterRole(*query, entry))
+                    {
+                        added.push_back(makeRow(*query, entry));
+                    }
+                });
+            }
+
+            // the new rows are merged into the sorted ones, nothing else is sorted again
+            if (!added.empty())
+            {
+                const auto less = lessThan(*query);
+                std::sort(added.begin(), added.end(), less);
+
+                const auto middle = static_cast<std::ptrdiff_t>(rows.size());
+                rows.insert(rows.end(), std::make_move_iterator(added.begin()), std::make_move_iterator(added.end()));
+                std::inplace_merge(rows.begin(), rows.begin() + middle, rows.end(), less);
+            }
+        }
+
+        if (query)
+        {
+            countActive(*query);
+        }
+    }
+
+    // filters and sorts the index for |q|, only the steps the change of the query needs
+    bool select(const Query& q, uint64_t requestId)
+    {
+        if (query && *query == q)
+        {
+            return true;
+        }
+
+        if (query && sameCriteria(*query, q))
+        {
+            for (auto& row : rows)
+            {
+                row = makeRow(q, *row.entry);
+            }
+            std::sort(rows.begin(), rows.end(), lessThan(q));
+            query = q;
+            return true;
+        }
+
+        query.reset();
+        rows.clear();
+
+        if (!matchText(q.searchText, requestId))
+        {
+            return false;
+        }
+
+        for (const auto& [txId, entry] : entries)
+        {
+            if (accepts(q, entry) && matchesFilterRole(q, entry))
+            {
+                rows.push_back(makeRow(q, entry));
+            }
+        }
+        std::sort(rows.begin(), rows.end(), lessThan(q));
+
+        query = q;
+        countActive(q);
+        return true;
+    }
+
+    // the transactions whose search text, the one TxObjectList indexes, contains |text|
+    bool matchText(const QString& text, uint64_t requestId)
+    {
+        const auto folded = text.toCaseFolded();
+        if (folded == matchedText)
+        {
+            return true;
+        }
+
+        if (folded.isEmpty())
+        {
+            textMatches.clear();
+            matchedText.clear();
+            return true;
+        }
+
+        TxIDSet matches;
+        auto check = [this, &folded, &matches](const beam::wallet::TxDescription& tx)
+        {
+            withTxObject(tx, currency, [&folded, &matches](const TxObject& object)
+            {
+                if (object.getSearchText().toCaseFolded().contains(folded))
+                {
+                    matches.insert(object.getTxID());
+                }
+            });
+        };
+
+        if (!matchedText.isEmpty() && folded.contains(matchedText))
+        {
+            // a longer text matches only some of the previous matches
+            int checked = 0;
+            for (const auto& txId : textMatches)
+            {
+                if (++checked % kScanChunk == 0 && isCancelled(requestId))
+                {
+                    return false;
+                }
+
+                if (auto tx = walletDB->getTx(txId))
+                {
+                    check(*tx);
+                }
+            }
+        }
+        else
+        {
+            for (uint64_t start = 0;; start += kScanChunk)
+            {
+                if (isCancelled(requestId))
+                {
+                    return false;
+                }
+
+                auto chunk = walletDB->getTxHistory(beam::wallet::TxType::ALL, start, kScanChunk);
+                for (const auto& tx : chunk)
+                {
+                    check(tx);
+                }
+
+                if (chunk.size() < static_cast<size_t>(kScanChunk))
+                {
+                    break;
+                }
+            }
+        }
+
+        textMatches = std::move(matches);
+        matchedText = folded;
+        return true;
+    }
+
+    [[nodiscard]] bool accepts(const Query& q, const Entry& entry) const
+    {
+        return matchesCriteria(q, entry) && (matchedText.isEmpty() || textMatches.count(entry.txId) > 0);
+    }
+
+    // TxTable shows the active transactions among the ones the criteria accept, whatever the tab is
+    void countActive(const Query& q)
+    {
+        activeCount = 0;
+        for (const auto& [txId, entry] : entries)
+        {
+            if (entry.has(Entry::Active) && accepts(q, entry))
+            {
+                ++activeCount;
+            }
+        }
+    }
+
+    [[nodiscard]] Row makeRow(const Query& q, const Entry& entry) const
+    {
+        Row row;
+        row.entry = &entry;
+
+        switch (q.sortRole)
+        {
+            case Roles::AmountGeneralSort:
+                row.number = entry.amount;
+                break;
+            case Roles::AmountSecondCurrencySort:
+                row.number = entry.secondAmount;
+                break;
+            case Roles::StatusSort:
+                row.number = static_cast<uint64_t>(entry.uiStatus);
+                break;
+            case Roles::SourceSort:
+                row.text = foldedKey(entry.source);
+                break;
+            case Roles::ActionSort:
+                row.text = foldedKey(entry.action);
+                break;
+            case Roles::AssetNamesSort:
+            {
+                QString names;
+                for (auto assetId : entry.getAssets())
+                {
+                    if (!names.isEmpty())
+                    {
+                        names += ",";
+                    }
+                    auto it = q.assetNames.find(assetId);
+                    names += it != q.assetNames.end() ? it->second : QString();
+                }
+                row.text = foldedKey(names);
+                break;
+            }
+            case Roles::TimeCreatedSort:
+            default:
+                row.number = entry.time;
+                break;
+        }
+        return row;
+    }
+
+    // sort keys repeat a lot, they are folded once
+    [[nodiscard]] QString foldedKey(const QString& text) const
+    {
+        auto it = foldedKeys.find(text);
+        if (it == foldedKeys.end())
+        {
+            it = foldedKeys.insert(text, text.toCaseFolded());
+        }
+        return *it;
+    }
+
+    // equal keys keep the newest transaction first
+    static auto lessThan(const Query& q)
+    {
+        return [ascending = q.ascending](const Row& left, const Row& right)
+        {
+            if (left.text != right.text)
+            {
+                return ascending ? left.text < right.text : right.text < left.text;
+            }
+            if (left.number != right.number)
+            {
+                return ascending ? left.number < right.number : left.number > right.number;
+            }
+            if (left.entry->time != right.entry->time)
+            {
+                return left.entry->time > right.entry->time;
+            }
+            return left.entry->txId < right.entry->txId;
+        };
+    }
+
+    beam::wallet::IWalletDB::Ptr walletDB;
+    std::atomic<uint64_t> latestRequest = 0;
+    std::atomic<int> scanned = 0;
+
+    beam::wallet::Currency currency;
+    bool built = false;
+    std::unordered_map<beam::wallet::TxID, Entry, ListModelKeyHash> entries;
+    std::set<beam::Asset::ID> assets;
+
+    QString matchedText;    // case folded
+    TxIDSet textMatches;
+
+    std::optional<Query> query;     // the one the rows are for
+    std::vector<Row> rows;
+    int activeCount = 0;
+    mutable QHash<QString, QString> foldedKeys;
+};
+
+struct TxPagedList::Page
+{
+    uint64_t requestId = 0;
+    uint64_t queryId = 0;
+    bool cancelled = false;
+    int total = 0;
+    int first = 0;
+    int activeCount = 0;
+    int located = -1;
+    std::set<beam::Asset::ID> assets;
+    std::vector<beam::wallet::TxDescription> items;
+};
+
+TxPagedList::TxPagedList()
+    : _model(AppModel::getInstance().getWalletModel())
+    , _txStore(AppModel::getInstance().getTxStore())
+    , _amgr(AppModel::getInstance().getAssets())
+    , _backend(std::make_shared<Backend>(AppModel::getInstance().getWalletDB()))
+    , _secondCurrency(AppModel::getInstance().getRates()->getRateCurrency())
+{
+    _requestTimer.setSingleShot(true);
+    _requestTimer.setInterval(kRequestDelayMs);
+    connect(&_requestTimer, &QTimer::timeout, this, &TxPagedList::sendRequest);
+
+    _progressTimer.setInterval(kProgressIntervalMs);
+    connect(&_progressTimer, &QTimer::timeout, this, &TxPagedList::reportProgress);
+
+    connect(&_window, &QAbstractItemModel::dataChanged, this, &TxPagedList::onWindowDataChanged);
+    connect(_txStore.get(), &TxStore::transactionsChanged, this, &TxPagedList::onTransactionsChanged);
+    connect(_amgr.get(), &AssetsManager::assetInfo, this, &TxPagedList::onAssetInfo);
+
+    connect(this, &QAbstractItemModel::rowsInserted, this, &TxPagedList::countChanged);
+    connect(this, &QAbstractItemModel::rowsRemoved, this, &TxPagedList::countChanged);
+    connect(this, &QAbstractItemModel::modelReset, this, &TxPagedList::countChanged);
+
+    // the first full history of the store is a reset, it starts the index
+    if (_txStore->isLoaded())
+    {
+        rebuild();
+    }
+}
+
+TxPagedList::~TxPagedList()
+{
+    // a request still running on the wallet thread stops at the next chunk
+    ++_backend->latestRequest;
+}
+
+int TxPagedList::rowCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : _total;
+}
+
+QVariant TxPagedList::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.row() < 0 || index.row() >= _total)
+    {
+        return QVariant();
+    }
+
+    const int row = index.row();
+    const int local = row - _windowStart;
+    const int loaded = _window.rowCount();
+    const bool isLoaded = local >= 0 && local < loaded;
+
+    // move the window before the view reaches its edge
+    const bool nearStart = local < kPrefetch / 2 && _windowStart > 0;
+    const bool nearEnd = local >= loaded - kPrefetch / 2 && _windowStart + loaded < _total;
+    if (!isLoaded || nearStart || nearEnd)
+    {
+        requestRow(row);
+    }
+
+    return isLoaded ? _window.data(_window.index(local), role) : QVariant();
+}
+
+QHash<int, QByteArray> TxPagedList::roleNames() const
+{
+    return _window.roleNames();
+}
+
+QVariant TxPagedList::getRoleValue(int row, QByteArray roleName) const
+{
+    const int role = roleOf(QString::fromLatin1(roleName));
+    return role >= 0 ? data(index(row), role) : QVariant();
+}
+
+const TxPagedList::Query& TxPagedList::getQuery() const
+{
+    return _query;
+}
+
+void TxPagedList::setQuery(const Query& query)
+{
+    if (_query == query)
+    {
+        return;
+    }
+
+    _query = query;
+    ++_queryId;
+    updateAssetNames();
+    emit queryChanged();
+    requestRow(0);
+}
+
+QString TxPagedList::getSortRole() const
+{
+    return QString::fromLatin1(roleNames().value(static_cast<int>(_query.sortRole)));
+}
+
+void TxPagedList::setSortRole(const QString& roleName)
+{
+    // columns without a sort role keep the default order
+    const int role = roleOf(roleName);
+    auto query = _query;
+    query.sortRole = role >= 0 ? static_cast<TxObjectList::Roles>(role) : TxObjectList::Roles::TimeCreatedSort;
+    setQuery(query);
+}
+
+Qt::SortOrder TxPagedList::getSortOrder() const
+{
+    return _query.ascending ? Qt::AscendingOrder : Qt::DescendingOrder;
+}
+
+void TxPagedList::setSortOrder(Qt::SortOrder order)
+{
+    auto query = _query;
+    query.ascending = order == Qt::AscendingOrder;
+    setQuery(query);
+}
+
+QString TxPagedList::getFilterRole() const
+{
+    return _query.filterRole ? QString::fromLatin1(roleNames().value(static_cast<int>(*_query.filterRole))) : QString();
+}
+
+void TxPagedList::setFilterRole(const QString& roleName)
+{
+    const int role = roleOf(roleName);
+    auto query = _query;
+    query.filterRole.reset();
+    if (role >= 0)
+    {
+        query.filterRole = static_cast<TxObjectList::Roles>(role);
+    }
+    setQuery(query);
+}
+
+void TxPagedList::setSecondCurrency(const beam::wallet::Currency& currency)
+{
+    if (_secondCurrency.m_value == currency.m_value)
+    {
+        return;
+    }
+
+    _secondCurrency = currency;
+    rebuild();
+}
+
+void TxPagedList::invalidateRates()
+{
+    _window.invalidateRates();
+}
+
+void TxPagedList::locate(const QString& txId)
+{
+    auto buffer = beam::from_hex(txId.toStdString());
+    if (buffer.size() != sizeof(beam::wallet::TxID))
+    {
+        return;
+    }
+
+    beam::wallet::TxID id;
+    std::copy_n(buffer.begin(), id.size(), id.begin());
+    _locateTx = id;
+    requestRow(_wantedRow);
+}
+
+int TxPagedList::getActiveCount() const
+{
+    return _activeCount;
+}
+
+bool TxPagedList::isLoading() const
+{
+    return _loading;
+}
+
+void TxPagedList::onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items)
+{
+    if (action == beam::wallet::ChangeAction::Reset)
+    {
+        rebuild();
+        return;
+    }
+
+    // queued behind the running request, the rows change in place on the wallet thread
+    _model->getAsync()->makeIWTCall(
+        [backend = _backend, action, items]() -> boost::any
+        {
+            backend->apply(action, items);
+            return boost::any();
+        },
+        [](const boost::any&) {});
+
+    // a running request was sent before the change, it is repeated once it is back
+    if (_requestPending)
+    {
+        _refreshPending = true;
+    }
+    else
+    {
+        requestRow(_wantedRow);
+    }
+}
+
+void TxPagedList::onAssetInfo(beam::Asset::ID assetId)
+{
+    if (_query.sortRole == TxObjectList::Roles::AssetNamesSort && _historyAssets.count(assetId))
+    {
+        updateAssetNames();
+    }
+}
+
+// asset info and rates refresh the loaded rows, their roles go on to the view
+void TxPagedList::onWindowDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight, const QVector<int>& roles)
+{
+    emit dataChanged(index(_windowStart + topLeft.row()), index(_windowStart + bottomRight.row()), roles);
+}
+
+void TxPagedList::rebuild()
+{
+    _rebuild = true;
+    ++_queryId;
+    setLoading(true);
+    requestRow(0);
+}
+
+// the names are a part of the query only while the list is sorted by them
+void TxPagedList::updateAssetNames()
+{
+    std::map<beam::Asset::ID, QString> names;
+    if (_query.sortRole == TxObjectList::Roles::AssetNamesSort)
+    {
+        for (auto assetId : _historyAssets)
+        {
+            names[assetId] = _amgr->getUnitName(assetId, AssetsManager::NoShorten);
+        }
+    }
+
+    if (names != _query.assetNames)
+    {
+        _query.assetNames = std::move(names);
+        ++_queryId;
+        requestRow(0);
+    }
+}
+
+void TxPagedList::requestRow(int row) const
+{
+    // restarted by every call, so a request goes out once scrolling settles
+    _wantedRow = row;
+    _requestTimer.start();
+}
+
+void TxPagedList::sendRequest()
+{
+    const auto requestId = ++_requestId;
+    _backend->latestRequest = requestId;
+    _requestPending = true;
+    _refreshPending = false;
+
+    const bool rebuildIndex = std::exchange(_rebuild, false);
+    const auto locateTx = std::exchange(_locateTx, std::nullopt);
+    const int first = std::max(0, _wantedRow - kPrefetch);
+    const int count = kPageSize + 2 * kPrefetch;
+
+    _model->getAsync()->makeIWTCall(
+        [backend = _backend, query = _query, queryId = _queryId, currency = _secondCurrency, rebuildIndex, locateTx, requestId, first, count]() -> boost::any
+        {
+            Page page;
+            page.requestId = requestId;
+            page.queryId = queryId;
+
+            if ((rebuildIndex || !backend->built) && !backend->build(currency, requestId))
+            {
+                page.cancelled = true;
+                return page;
+            }
+
+            if (!backend->select(query, requestId))
+            {
+                page.cancelled = true;
+                return page;
+            }
+
+            const auto& rows = backend->rows;
+            page.total = static_cast<int>(rows.size());
+            page.activeCount = backend->activeCount;
+            page.assets = backend->assets;
+            page.first = first;
+
+            if (locateTx)
+            {
+                auto it = std::find_if(rows.begin(), rows.end(), [&locateTx](const Backend::Row& row)
+                {
+                    return row.entry->txId == *locateTx;
+                });
+
+                if (it != rows.end())
+                {
+                    page.located = static_cast<int>(it - rows.begin());
+                    page.first = std::max(0, page.located - kPrefetch);
+                }
+            }
+
+            page.first = std::min(page.first, std::max(0, page.total - count));
+
+            const int last = std::min(page.first + count, page.total);
+            page.items.reserve(last - page.first);
+            for (int i = page.first; i < last; ++i)
+            {
+                if (auto tx = backend->walletDB->getTx(rows[i].entry->txId))
+                {
+                    page.items.push_back(std::move(*tx));
+                }
+            }
+            return page;
+        },
+        [this, guard = QPointer<TxPagedList>(this)](const boost::any& result)
+        {
+            if (guard)
+            {
+                onPageLoaded(boost::any_cast<Page>(result));
+            }
+        });
+}
+
+void TxPagedList::onPageLoaded(Page&& page)
+{
+    if (page.requestId != _requestId)
+    {
+        return;
+    }
+
+    _requestPending = false;
+
+    // a later query cancelled it, the rebuild is still to be done
+    if (page.cancelled)
+    {
+        return;
+    }
+
+    setLoading(false);
+
+    std::vector<std::shared_ptr<TxObject>> objects;
+    objects.reserve(page.items.size());
+    for (const auto& tx : page.items)
+    {
+        objects.push_back(RowPool<TxObject>::make(tx, _secondCurrency));
+    }
+
+    if (page.queryId != _shownQueryId)
+    {
+        // another list, the view starts over
+        beginResetModel();
+        _shownQueryId = page.queryId;
+        _total = page.total;
+        _windowStart = page.first;
+        _window.reset(std::move(objects));
+        endResetModel();
+    }
+    else
+    {
+        const int oldFirst = _windowStart;
+        const int oldLast = _windowStart + _window.rowCount() - 1;
+
+        _windowStart = page.first;
+        _window.reset(std::move(objects));
+
+        // deltas moved the rows, the count changes at the end and every row of both windows
+        // gets its new data, rows which left the window become placeholders
+        if (page.total > _total)
+        {
+            beginInsertRows(QModelIndex(), _total, page.total - 1);
+            _total = page.total;
+            endInsertRows();
+        }
+        else if (page.total < _total)
+        {
+            beginRemoveRows(QModelIndex(), page.total, _total - 1);
+            _total = page.total;
+            endRemoveRows();
+        }
+
+        const int first = std::min(oldFirst, _windowStart);
+        const int last = std::min(std::max(oldLast, _windowStart + _window.rowCount() - 1), _total - 1);
+        if (last >= first)
+        {
+            emit dataChanged(index(first), index(last));
+        }
+    }
+
+    if (_activeCount != page.activeCount)
+    {
+        _activeCount = page.activeCount;
+        emit activeCountChanged();
+    }
+
+    if (_historyAssets != page.assets)
+    {
+        _historyAssets = std::move(page.assets);
+        updateAssetNames();
+    }
+
+    if (page.located >= 0)
+    {
+        emit txLocated(page.located);
+    }
+
+    if (_refreshPending)
+    {
+        requestRow(_wantedRow);
+    }
+}
+
+void TxPagedList::reportProgress()
+{
+    emit progress(_backend->scanned, static_cast<int>(_txStore->size()));
+}
+
+void TxPagedList::setLoading(bool value)
+{
+    if (_loading == value)
+    {
+        return;
+    }
+
+    _loading = value;
+    if (_loading)
+    {
+        _progressTimer.start();
+    }
+    else
+    {
+        _progressTimer.stop();
+    }
+    emit loadingChanged();
+}
+
+int TxPagedList::roleOf(const QString& roleName) const
+{
+    const auto roles = roleNames();
+    for (auto it = roles.begin(); it != roles.end(); ++it)
+    {
+        if (QString::fromLatin1(it.value()) == roleName)
+        {
+            return it.key();
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,141 @@
+// Copyright 2018 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QAbstractListModel>
+#include <QTimer>
+#include <array>
+#include <map>
+#include <optional>
+#include <set>
+#include "model/wallet_model.h"
+#include "model/tx_store.h"
+#include "model/assets_manager.h"
+#include "tx_object_list.h"
+
+// Transaction list which keeps only a window of rows in the UI.
+// The wallet thread keeps a compact row index of the history, built once from the wallet DB
+// and then updated by the TxStore deltas. It filters and sorts the index by the values
+// TxObject gives to the other transaction views and loads full descriptions only for the
+// requested window, so the view never holds the whole history. Row requests made while
+// scrolling are debounced and every new request cancels the previous one.
+class TxPagedList : public QAbstractListModel
+{
+    Q_OBJECT
+    Q_PROPERTY(int count                READ rowCount       NOTIFY countChanged)
+    Q_PROPERTY(int activeCount          READ getActiveCount NOTIFY activeCountChanged)
+    Q_PROPERTY(bool loading             READ isLoading      NOTIFY loadingChanged)
+    Q_PROPERTY(QString sortRole         READ getSortRole    WRITE setSortRole   NOTIFY queryChanged)
+    Q_PROPERTY(Qt::SortOrder sortOrder  READ getSortOrder   WRITE setSortOrder  NOTIFY queryChanged)
+    Q_PROPERTY(QString filterRole       READ getFilterRole  WRITE setFilterRole NOTIFY queryChanged)
+
+public:
+    static constexpr size_t kStatusCount = static_cast<size_t>(TxFilterStatus::Count);
+
+    // the criteria of TxFilterModel, the tab and the sorting of the view
+    struct Query
+    {
+        // transactions without a known status are never shown
+        std::array<bool, kStatusCount> statusVisible = { true, true, true, true, false };
+        std::vector<beam::Asset::ID> assets;    // sorted, empty accepts every asset
+        bool dexOnly = false;
+        QString dappFilter;                     // empty, TxFilterModel::kAllDapps or a DApp id
+        QString searchText;
+        std::optional<TxObjectList::Roles> filterRole;  // IsInProgress, IsSent or IsReceived
+        TxObjectList::Roles sortRole = TxObjectList::Roles::TimeCreatedSort;
+        bool ascending = false;
+        std::map<beam::Asset::ID, QString> assetNames;  // filled only to sort by asset names
+
+        bool operator==(const Query& other) const = default;
+    };
+
+    TxPagedList();
+    ~TxPagedList() override;
+
+    [[nodiscard]] int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    [[nodiscard]] QVariant data(const QModelIndex& index, int role) const override;
+    [[nodiscard]] QHash<int, QByteArray> roleNames() const override;
+    Q_INVOKABLE QVariant getRoleValue(int row, QByteArray roleName) const;
+
+    [[nodiscard]] const Query& getQuery() const;
+    void setQuery(const Query& query);
+
+    [[nodiscard]] QString getSortRole() const;
+    void setSortRole(const QString& roleName);
+    [[nodiscard]] Qt::SortOrder getSortOrder() const;
+    void setSortOrder(Qt::SortOrder order);
+    [[nodiscard]] QString getFilterRole() const;
+    void setFilterRole(const QString& roleName);
+
+    // amounts in the second currency are part of the index, a new currency rebuilds it
+    void setSecondCurrency(const beam::wallet::Currency& currency);
+    void invalidateRates();
+
+    // loads the window around the transaction, txLocated tells its row once it is loaded
+    Q_INVOKABLE void locate(const QString& txId);
+
+    [[nodiscard]] int getActiveCount() const;
+    // true while the index is read from the wallet DB
+    [[nodiscard]] bool isLoading() const;
+
+signals:
+    void countChanged();
+    void activeCountChanged();
+    void queryChanged();
+    void loadingChanged();
+    void progress(int done, int total);
+    void txLocated(int row);
+
+private:
+    struct Backend;
+    struct Page;
+
+    void onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items);
+    void onAssetInfo(beam::Asset::ID assetId);
+    void onWindowDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight, const QVector<int>& roles);
+    void rebuild();
+    void updateAssetNames();
+    void requestRow(int row) const;
+    void sendRequest();
+    void onPageLoaded(Page&& page);
+    void reportProgress();
+    void setLoading(bool value);
+    [[nodiscard]] int roleOf(const QString& roleName) const;
+
+    WalletModel::Ptr _model;
+    TxStore::Ptr _txStore;
+    AssetsManager::Ptr _amgr;
+    std::shared_ptr<Backend> _backend;
+    Query _query;
+    uint64_t _queryId = 1;       // changes with the query and with every rebuild of the index
+    uint64_t _shownQueryId = 0;
+    beam::wallet::Currency _secondCurrency;
+    bool _rebuild = true;
+    std::set<beam::Asset::ID> _historyAssets;
+
+    TxObjectList _window;   // formats the loaded rows
+    int _windowStart = 0;
+    int _total = 0;
+    int _activeCount = 0;
+
+    mutable int _wantedRow = 0;
+    mutable QTimer _requestTimer;
+    std::optional<beam::wallet::TxID> _locateTx;
+    uint64_t _requestId = 0;
+    bool _requestPending = false;
+    bool _refreshPending = false;   // deltas came while a request was running
+
+    QTimer _progressTimer;
+    bool _loading = false;
+};
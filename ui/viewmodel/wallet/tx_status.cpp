@@ -0,0 +1,209 @@
+// Copyright 2019 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tx_status.h"
+#include <algorithm>
+#include <array>
+#include <unordered_map>
+
+namespace
+{
+    using StatusTexts = std::array<QString, static_cast<size_t>(TxUIStatus::Count)>;
+
+    StatusTexts& getStatusTexts()
+    {
+        static StatusTexts texts;
+        return texts;
+    }
+
+    bool& isTranslated()
+    {
+        static bool translated = false;
+        return translated;
+    }
+
+    void setText(StatusTexts& texts, TxUIStatus status, QString text)
+    {
+        texts[static_cast<size_t>(status)] = std::move(text);
+    }
+}
+
+namespace beamui
+{
+    TxUIStatus getTxUIStatus(const std::string& status, beam::wallet::TxAddressType addressType)
+    {
+        static const std::unordered_map<std::string, TxUIStatus> kStatuses =
+        {
+            { "pending",                                    TxUIStatus::Pending },
+            { "waiting for sender",                         TxUIStatus::WaitingForSender },
+            { "waiting for receiver",                       TxUIStatus::WaitingForReceiver },
+            { "in progress",                                TxUIStatus::InProgress },
+            { "sent to own address",                        TxUIStatus::SentToOwn },
+            { "sending to own address",                     TxUIStatus::SendingToOwn },
+            { "received",                                   TxUIStatus::Received },
+            { "sent",                                       TxUIStatus::Sent },
+            { "cancelled",                                  TxUIStatus::Canceled },
+            { "expired",                                    TxUIStatus::Expired },
+            { "failed",                                     TxUIStatus::Failed },
+            { "in progress maximum anonymity",              TxUIStatus::InProgressMaxPrivacy },
+            { "sending maximum anonymity to own address",   TxUIStatus::SendingMaxPrivacyToOwn },
+            { "in progress offline",                        TxUIStatus::InProgressOffline },
+            { "in progress public offline",                 TxUIStatus::InProgressPublicOffline },
+            { "sending offline to own address",             TxUIStatus::SendingOfflineToOwn },
+            { "sending public offline to own address",      TxUIStatus::SendingPublicOfflineToOwn },
+            { "sent maximum anonymity",                     TxUIStatus::SentMaxPrivacy },
+            { "sent offline",                               TxUIStatus::SentOffline },
+            { "sent public offline",                        TxUIStatus::SentPublicOffline },
+            { "sent maximum anonymity to own address",      TxUIStatus::SentMaxPrivacyToOwn },
+            { "sent offline to own address",                TxUIStatus::SentOfflineToOwn },
+            { "sent public offline to own address",         TxUIStatus::SentPublicOfflineToOwn },
+            { "received maximum anonymity",                 TxUIStatus::ReceivedMaxPrivacy },
+            { "received offline",                           TxUIStatus::ReceivedOffline },
+            { "received public offline",                    TxUIStatus::ReceivedPublicOffline },
+            { "canceled maximum anonymity",                 TxUIStatus::CanceledMaxPrivacy },
+            { "canceled offline",                           TxUIStatus::CanceledOffline },
+            { "canceled public offline",                    TxUIStatus::CanceledPublicOffline },
+            { "failed maximum anonymity",                   TxUIStatus::FailedMaxPrivacy },
+            { "failed offline",                             TxUIStatus::FailedOffline },
+            { "failed public offline",                      TxUIStatus::FailedPublicOffline },
+            { "completed",                                  TxUIStatus::Completed },
+            { "confirming",                                 TxUIStatus::Confirming },
+        };
+
+        auto it = kStatuses.find(status);
+        if (it == kStatuses.end())
+        {
+            return TxUIStatus::Unknown;
+        }
+
+        if (it->second == TxUIStatus::WaitingForReceiver && addressType == beam::wallet::TxAddressType::Offline)
+        {
+            return TxUIStatus::WaitingForReceiverOffline;
+        }
+        return it->second;
+    }
+
+    const QString& getTxUIStatusText(TxUIStatus status)
+    {
+        if (!isTranslated())
+        {
+            retranslateTxUIStatuses();
+        }
+
+        const auto idx = std::min(static_cast<size_t>(status), static_cast<size_t>(TxUIStatus::Unknown));
+        return getStatusTexts()[idx];
+    }
+
+    void retranslateTxUIStatuses()
+    {
+        auto& t = getStatusTexts();
+
+        //% "pending"
+        setText(t, TxUIStatus::Pending, qtTrId("wallet-txs-status-pending"));
+        //% "waiting for sender"
+        setText(t, TxUIStatus::WaitingForSender, qtTrId("wallet-txs-status-waiting-sender"));
+        //% "waiting for receiver"
+        setText(t, TxUIStatus::WaitingForReceiver, qtTrId("wallet-txs-status-waiting-receiver"));
+        /*% "waiting for receiver
+(offline)"*/
+        setText(t, TxUIStatus::WaitingForReceiverOffline, qtTrId("wallet-txs-status-waiting-receiver-offline"));
+        //% "in progress"
+        setText(t, TxUIStatus::InProgress, qtTrId("wallet-txs-status-in-progress"));
+        //% "sent to own address"
+        setText(t, TxUIStatus::SentToOwn, qtTrId("wallet-txs-status-own-sent"));
+        //% "sending to own address"
+        setText(t, TxUIStatus::SendingToOwn, qtTrId("wallet-txs-status-own-sending"));
+        //% "received"
+        setText(t, TxUIStatus::Received, qtTrId("wallet-txs-status-received"));
+        //% "sent"
+        setText(t, TxUIStatus::Sent, qtTrId("wallet-txs-status-sent"));
+        //% "canceled"
+        setText(t, TxUIStatus::Canceled, qtTrId("wallet-txs-status-cancelled"));
+        //% "expired"
+        setText(t, TxUIStatus::Expired, qtTrId("wallet-txs-status-expired"));
+        //% "failed"
+        setText(t, TxUIStatus::Failed, qtTrId("wallet-txs-status-failed"));
+        // in progress
+        /*% "in progress
+(maximum anonymity)" */
+        setText(t, TxUIStatus::InProgressMaxPrivacy, qtTrId("wallet-txs-status-in-progress-max"));
+        /*% "sending to own address
+(maximum anonymity)" */
+        setText(t, TxUIStatus::SendingMaxPrivacyToOwn, qtTrId("wallet-txs-status-in-progress-max-to-own"));
+        /*% "in progress (offline)" */
+        setText(t, TxUIStatus::InProgressOffline, qtTrId("wallet-txs-status-in-progress-max-offline"));
+        /*% "in progress
+(public offline)" */
+        setText(t, TxUIStatus::InProgressPublicOffline, qtTrId("wallet-txs-status-in-progress-public-offline"));
+        /*% "sending to own address
+(offline)" */
+        setText(t, TxUIStatus::SendingOfflineToOwn, qtTrId("wallet-txs-status-in-progress-offline-to-own"));
+        /*% "sending to own address
+(public offline)" */
+        setText(t, TxUIStatus::SendingPublicOfflineToOwn, qtTrId("wallet-txs-status-in-progress-pub-offline-to-own"));
+        // sent
+        /*% "sent
+(maximum anonymity)"*/
+        setText(t, TxUIStatus::SentMaxPrivacy, qtTrId("wallet-txs-status-sent-max"));
+        /*% "sent (offline)" */
+        setText(t, TxUIStatus::SentOffline, qtTrId("wallet-txs-status-sent-max-offline"));
+        /*% "sent
+(public offline)" */
+        setText(t, TxUIStatus::SentPublicOffline, qtTrId("wallet-txs-status-sent-public-offline"));
+        /*% "sent to own address
+(maximum anonymity)" */
+        setText(t, TxUIStatus::SentMaxPrivacyToOwn, qtTrId("wallet-txs-status-sent-max-to-own"));
+        /*% "sent to own address
+(offline)" */
+        setText(t, TxUIStatus::SentOfflineToOwn, qtTrId("wallet-txs-status-sent-offline-to-own"));
+        /*% "sent to own address
+(public offline)" */
+        setText(t, TxUIStatus::SentPublicOfflineToOwn, qtTrId("wallet-txs-status-sent-pub-offline-to-own"));
+        // received
+        /*% "received
+(maximum anonymity)" */
+        setText(t, TxUIStatus::ReceivedMaxPrivacy, qtTrId("wallet-txs-status-received-max"));
+        /*% "received (offline)" */
+        setText(t, TxUIStatus::ReceivedOffline, qtTrId("wallet-txs-status-received-max-offline"));
+        /*% "received
+(public offline)" */
+        setText(t, TxUIStatus::ReceivedPublicOffline, qtTrId("wallet-txs-status-received-public-offline"));
+        // canceled
+        /*% "canceled
+(maximum anonymity)" */
+        setText(t, TxUIStatus::CanceledMaxPrivacy, qtTrId("wallet-txs-status-canceled-max"));
+        /*% "canceled (offline)" */
+        setText(t, TxUIStatus::CanceledOffline, qtTrId("wallet-txs-status-canceled-max-offline"));
+        /*% "canceled
+(public offline)" */
+        setText(t, TxUIStatus::CanceledPublicOffline, qtTrId("wallet-txs-status-canceled-public-offline"));
+        // failed
+        /*% "failed
+(maximum anonymity)" */
+        setText(t, TxUIStatus::FailedMaxPrivacy, qtTrId("wallet-txs-status-failed-max"));
+        /*% "failed (offline)" */
+        setText(t, TxUIStatus::FailedOffline, qtTrId("wallet-txs-status-failed-max-offline"));
+        /*% "failed
+(public offline)" */
+        setText(t, TxUIStatus::FailedPublicOffline, qtTrId("wallet-txs-status-failed-public-offline"));
+        //% "completed"
+        setText(t, TxUIStatus::Completed, qtTrId("wallet-txs-status-completed"));
+        //% "confirming"
+        setText(t, TxUIStatus::Confirming, qtTrId("wallet-txs-status-confirming"));
+        //% "unknown"
+        setText(t, TxUIStatus::Unknown, qtTrId("wallet-txs-status-unknown"));
+
+        isTranslated() = true;
+    }
+}  // namespace beamui
@@ -0,0 +1,80 @@
+// Copyright 2019 The Beam Team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <QString>
+#include "wallet/core/common.h"
+
+// Transaction status as shown in the transactions table: beam::wallet::interpretStatus()
+// combined with the address type. The order is the order of the status column sorting.
+enum class TxUIStatus : uint8_t
+{
+    Pending,
+    WaitingForSender,
+    WaitingForReceiver,
+    WaitingForReceiverOffline,
+    InProgress,
+    InProgressMaxPrivacy,
+    InProgressOffline,
+    InProgressPublicOffline,
+    SendingToOwn,
+    SendingMaxPrivacyToOwn,
+    SendingOfflineToOwn,
+    SendingPublicOfflineToOwn,
+    Confirming,
+    Completed,
+    Sent,
+    SentMaxPrivacy,
+    SentOffline,
+    SentPublicOffline,
+    SentToOwn,
+    SentMaxPrivacyToOwn,
+    SentOfflineToOwn,
+    SentPublicOfflineToOwn,
+    Received,
+    ReceivedMaxPrivacy,
+    ReceivedOffline,
+    ReceivedPublicOffline,
+    Canceled,
+    CanceledMaxPrivacy,
+    CanceledOffline,
+    CanceledPublicOffline,
+    Expired,
+    Failed,
+    FailedMaxPrivacy,
+    FailedOffline,
+    FailedPublicOffline,
+    Unknown,
+    Count
+};
+
+// Status groups the transactions table can be filtered by
+enum class TxFilterStatus : uint8_t
+{
+    InProgress,
+    Completed,
+    Canceled,
+    Failed,
+    Unknown,
+    Count
+};
+
+namespace beamui
+{
+    TxUIStatus getTxUIStatus(const std::string& status, beam::wallet::TxAddressType addressType);
+    const QString& getTxUIStatusText(TxUIStatus status);
+
+    /// Rebuilds the translated status texts, should be called once the translation is changed
+    void retranslateTxUIStatuses();
+}  // namespace beamui
@@ -15,51 +15,59 @@
 #include <QFileDialog>
 #include <QStandardPaths>
 #include <QDateTime>
-#include <QTextStream>
-#include <QTextCodec>
+#include <QPointer>
+#include <algorithm>
 #include <vector>
 #include "model/app_model.h"
-#include "quazip/quazip.h"
-#include "quazip/quazipfile.h"
 
 namespace
 {
     const char kTxHistoryFileNamePrefix[] = "transaction_history_";
     const char kTxHistoryFileFormatDesc[] = "Zip Archive (*.zip)";
     const char kTxHistoryFileNameFormat[] = "yyyy_MM_dd_HH_mm_ss";
+    const char kTxHistoryColumnsFormatDesc[] = "Beam Transaction Columns (*.btxc)";
+    const int kTxHistoryColumnsChunk = 1000;
 
-    void writeZipFile(QuaZipFile& zipFile, const QString& data)
-    {
-        QTextCodec *codec = QTextCodec::codecForName("UTF8");
-        QTextStream out(&zipFile);
-        out.setCodec(codec);
-        out << data;
-    }
+    const QString kTxHistoryPart = "transactions.csv";
+    const QString kAtomicSwapTxHistoryPart = "atomic_swap_transactions.csv";
+    const QString kAssetsSwapTxHistoryPart = "assets_swap_transactions.csv";
+    const QString kContractTxHistoryPart = "contracts_transactions.csv";
+
+    const int kTxHistoryPartsCount = 2
+#ifdef BEAM_ATOMIC_SWAP_SUPPORT
+        + 1
+#endif // BEAM_ATOMIC_SWAP_SUPPORT
+#ifdef BEAM_ASSET_SWAP_SUPPORT
+        + 1
+#endif  // BEAM_ASSET_SWAP_SUPPORT
+        ;
 }
 
 TxTableViewModel::TxTableViewModel()
     : _model(AppModel::getInstance().getWalletModel())
     , _rates(AppModel::getInstance().getRates())
+    , _assetStats(AppModel::getInstance().getAssetStats())
     , _settings{AppModel::getInstance().getSettings()}
 {
-    connect(_model, SIGNAL(transactionsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)), SLOT(onTransactionsChanged(beam::wallet::ChangeAction, const std::vector<beam::wallet::TxDescription>&)));
-    connect(_model, SIGNAL(txHistoryExportedToCsv(const QString&)), this, SLOT(onTxHistoryExportedToCsv(const QString&)));
+    connect(&_pagedTransactions, &TxPagedList::progress, this, &TxTableViewModel::onLoadingProgress);
+    connect(&_pagedTransactions, &TxPagedList::loadingChanged, this, &TxTableViewModel::loadingProgressChanged);
+    connect(_model, SIGNAL(txHistoryExportedToCsv(const QByteArray&)), this, SLOT(onTxHistoryExportedToCsv(const QByteArray&)));
 #ifdef BEAM_ATOMIC_SWAP_SUPPORT
-    connect(_model, SIGNAL(atomicSwapTxHistoryExportedToCsv(const QString&)), this, SLOT(onAtomicSwapTxHistoryExportedToCsv(const QString&)));
+    connect(_model, SIGNAL(atomicSwapTxHistoryExportedToCsv(const QByteArray&)), this, SLOT(onAtomicSwapTxHistoryExportedToCsv(const QByteArray&)));
 #endif // BEAM_ATOMIC_SWAP_SUPPORT
 #ifdef BEAM_ASSET_SWAP_SUPPORT
-    connect(_model, SIGNAL(assetsSwapTxHistoryExportedToCsv(const QString&)), this, SLOT(onAssetsSwapTxHistoryExportedToCsv(const QString&)));
+    connect(_model, SIGNAL(assetsSwapTxHistoryExportedToCsv(const QByteArray&)), this, SLOT(onAssetsSwapTxHistoryExportedToCsv(const QByteArray&)));
 #endif  // BEAM_ASSET_SWAP_SUPPORT
-    connect(_model, SIGNAL(contractTxHistoryExportedToCsv(const QString&)), this, SLOT(onContractTxHistoryExportedToCsv(const QString&)));
-    connect(_rates.get(), &ExchangeRatesManager::rateUnitChanged, this, &TxTableViewModel::rateChanged);
-    connect(_rates.get(), &ExchangeRatesManager::activeRateChanged, this, &TxTableViewModel::rateChanged);
+    connect(_model, SIGNAL(contractTxHistoryExportedToCsv(const QByteArray&)), this, SLOT(onContractTxHistoryExportedToCsv(const QByteArray&)));
+    connect(_rates.get(), &ExchangeRatesManager::rateUnitChanged, this, &TxTableViewModel::onRateChanged);
+    connect(_rates.get(), &ExchangeRatesManager::activeRateChanged, this, &TxTableViewModel::onRateChanged);
+    connect(_assetStats.get(), &AssetStats::statsChanged, this, &TxTableViewModel::onAssetStatsChanged);
 
     _showInProgress = _settings.getShowInProgress();
     _showCompleted = _settings.getShowCompleted();
     _showCanceled = _settings.getShowCanceled();
     _showFailed = _settings.getShowFailed();
-
-    _model->getAsync()->getTransactions();
+    updatePagedQuery();
 }
 
 void TxTableViewModel::exportTxHistoryToCsv()
@@ -75,161 +83,189 @@ void TxTableViewModel::exportTxHistoryToCsv()
 
     if (!path.isEmpty())
     {
-        _txHistoryToCsvPaths.enqueue(path);
+        auto mode = _settings.getTxExportParallel() ? TxHistoryExporter::Mode::Parallel : TxHistoryExporter::Mode::Streaming;
+        auto exporter = new TxHistoryExporter(path, kTxHistoryPartsCount, mode, _settings.getTxExportCompressionLevel(), this);
+        connect(exporter, &TxHistoryExporter::progress, this, &TxTableViewModel::onExportProgress);
+        connect(exporter, &TxHistoryExporter::finished, this, [this, exporter] (bool succeeded)
+        {
+            onExportFinished(exporter, succeeded);
+        });
+        _txHistoryExports.enqueue(exporter);
+        _exportRequests.enqueue({exporter, {}});
+        emit exportStateChanged();
+
         _model->getAsync()->exportTxHistoryToCsv();
     }
 }
 
-void TxTableViewModel::onTxHistoryExportedToCsv(const QString& data)
+void TxTableViewModel::exportTxHistoryToColumns()
 {
-    if (_txHistoryToCsvPaths.isEmpty()) return;
+    QDateTime now = QDateTime::currentDateTime();
+    QString path = QFileDialog::getSaveFileName(
+        nullptr,
+        //: transaction history screen, open file dialog for the columnar export
+        //% "Export transaction history to columnar file"
+        qtTrId("wallet-export-tx-history-columns-dialog"),
+        QDir(QStandardPaths::writableLocation(QStandardPaths::DesktopLocation))
+            .filePath(kTxHistoryFileNamePrefix + now.toString(kTxHistoryFileNameFormat)), kTxHistoryColumnsFormatDesc);
 
-    _txHistoryData = data;
+    if (path.isEmpty())
+    {
+        return;
+    }
 
-    if (_txHistoryData.isEmpty() ||
-#ifdef BEAM_ATOMIC_SWAP_SUPPORT
-        _atomicSwapTxHistoryData.isEmpty() ||
-#endif // BEAM_ATOMIC_SWAP_SUPPORT
-#ifdef BEAM_ASSET_SWAP_SUPPORT
-        _assetsSwapTxHistoryData.isEmpty() ||
-#endif  // BEAM_ASSET_SWAP_SUPPORT
-        _contractTxHistoryData.isEmpty() ) return;
+    auto exporter = new TxHistoryColumnsExporter(path, static_cast<qint64>(AppModel::getInstance().getTxStore()->size()), this);
+    connect(exporter, &TxHistoryColumnsExporter::progress, this, &TxTableViewModel::onExportProgress);
+    connect(exporter, &TxHistoryColumnsExporter::finished, this, [this, exporter] (bool succeeded)
+    {
+        onColumnsExportFinished(exporter, succeeded);
+    });
+    _columnsExports.enqueue(exporter);
+    emit exportStateChanged();
 
-    writeArchiveWithExportedTxData();
+    requestColumnsPage(exporter, 0);
 }
 
-#ifdef BEAM_ATOMIC_SWAP_SUPPORT
-void TxTableViewModel::onAtomicSwapTxHistoryExportedToCsv(const QString& data)
+void TxTableViewModel::requestColumnsPage(TxHistoryColumnsExporter* exporter, uint64_t start)
 {
-    if (_txHistoryToCsvPaths.isEmpty()) return;
-
-    _atomicSwapTxHistoryData = data;
+    // the wallet thread only reads one page, every transaction type goes in, the TxType column tells them apart
+    auto walletDB = AppModel::getInstance().getWalletDB();
+    _model->getAsync()->makeIWTCall(
+        [walletDB, start]() -> boost::any
+        {
+            return walletDB->getTxHistory(beam::wallet::TxType::ALL, start, kTxHistoryColumnsChunk);
+        },
+        [this, guard = QPointer<TxHistoryColumnsExporter>(exporter), start](const boost::any& result)
+        {
+            // a cancelled export stops asking for pages
+            if (!guard || !guard->acceptsPages())
+            {
+                return;
+            }
 
-    if (_txHistoryData.isEmpty() ||
-        _atomicSwapTxHistoryData.isEmpty() ||
-#ifdef BEAM_ASSET_SWAP_SUPPORT
-        _assetsSwapTxHistoryData.isEmpty() ||
-#endif  // BEAM_ASSET_SWAP_SUPPORT
-        _contractTxHistoryData.isEmpty() ) return;
+            auto page = boost::any_cast<std::vector<beam::wallet::TxDescription>>(result);
+            const bool last = page.size() < static_cast<size_t>(kTxHistoryColumnsChunk);
+            guard->addPage(std::move(page), last);
 
-    writeArchiveWithExportedTxData();
+            if (!last)
+            {
+                requestColumnsPage(guard, start + kTxHistoryColumnsChunk);
+            }
+        });
 }
-#endif // BEAM_ATOMIC_SWAP_SUPPORT
 
-#ifdef BEAM_ASSET_SWAP_SUPPORT
-void TxTableViewModel::onAssetsSwapTxHistoryExportedToCsv(const QString& data)
+void TxTableViewModel::cancelExport()
 {
-    if (_txHistoryToCsvPaths.isEmpty()) return;
-
-    _assetsSwapTxHistoryData = data;
+    for (auto exporter : _txHistoryExports)
+    {
+        exporter->cancel();
+    }
 
-    if (_txHistoryData.isEmpty() ||
-#ifdef BEAM_ATOMIC_SWAP_SUPPORT
-        _atomicSwapTxHistoryData.isEmpty() ||
-#endif // BEAM_ATOMIC_SWAP_SUPPORT
-        _assetsSwapTxHistoryData.isEmpty() ||
-        _contractTxHistoryData.isEmpty() ) return;
+    for (auto exporter : _columnsExports)
+    {
+        exporter->cancel();
+    }
+}
 
-    writeArchiveWithExportedTxData();
+bool TxTableViewModel::isExporting() const
+{
+    return !_txHistoryExports.isEmpty() || !_columnsExports.isEmpty();
 }
-#endif  // BEAM_ASSET_SWAP_SUPPORT
 
-void TxTableViewModel::onContractTxHistoryExportedToCsv(const QString& data)
+double TxTableViewModel::getExportProgress() const
 {
-    if (_txHistoryToCsvPaths.isEmpty()) return;
+    return _exportProgress;
+}
 
-    _contractTxHistoryData = data;
+void TxTableViewModel::onTxHistoryExportedToCsv(const QByteArray& data)
+{
+    addExportedPart(kTxHistoryPart, data);
+}
 
-    if (_txHistoryData.isEmpty() ||
 #ifdef BEAM_ATOMIC_SWAP_SUPPORT
-        _atomicSwapTxHistoryData.isEmpty() ||
+void TxTableViewModel::onAtomicSwapTxHistoryExportedToCsv(const QByteArray& data)
+{
+    addExportedPart(kAtomicSwapTxHistoryPart, data);
+}
 #endif // BEAM_ATOMIC_SWAP_SUPPORT
-#ifdef BEAM_ASSET_SWAP_SUPPORT
-        _assetsSwapTxHistoryData.isEmpty() ||
-#endif  // BEAM_ASSET_SWAP_SUPPORT
-        _contractTxHistoryData.isEmpty() ) return;
 
-    writeArchiveWithExportedTxData();
+#ifdef BEAM_ASSET_SWAP_SUPPORT
+void TxTableViewModel::onAssetsSwapTxHistoryExportedToCsv(const QByteArray& data)
+{
+    addExportedPart(kAssetsSwapTxHistoryPart, data);
 }
+#endif  // BEAM_ASSET_SWAP_SUPPORT
 
-QAbstractItemModel* TxTableViewModel::getTransactions()
+void TxTableViewModel::onContractTxHistoryExportedToCsv(const QByteArray& data)
 {
-    return &_transactionsList;
+    addExportedPart(kContractTxHistoryPart, data);
 }
 
-void TxTableViewModel::onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& transactions)
+void TxTableViewModel::addExportedPart(const QString& name, const QByteArray& data)
 {
-    using namespace beam::wallet;
+    // the wallet answers export requests in order, the oldest request still missing the part owns it.
+    // A cancelled export keeps its request until all of its parts arrived, they are dropped
+    for (auto it = _exportRequests.begin(); it != _exportRequests.end(); ++it)
+    {
+        if (it->receivedParts.contains(name))
+        {
+            continue;
+        }
 
-    std::vector<std::shared_ptr<TxObject>> modifiedTransactions;
-    modifiedTransactions.reserve(transactions.size());
-    const auto secondCurrency = _rates->getRateCurrency();
+        it->receivedParts.insert(name);
+        if (it->exporter && it->exporter->acceptsPart(name))
+        {
+            it->exporter->addPart(name, data);
+        }
 
-    for (const auto& t : transactions)
-    {
-        if(const auto txType = t.GetParameter<TxType>(TxParameterID::TransactionType))
+        if (it->receivedParts.size() == kTxHistoryPartsCount)
         {
-            switch(*txType)
-            {
-            case TxType::AtomicSwap:
-            case TxType::AssetIssue:
-            case TxType::AssetConsume:
-            case TxType::AssetReg:
-            case TxType::AssetUnreg:
-            case TxType::AssetInfo:
-            case TxType::PullTransaction:
-            case TxType::UnlinkFunds:
-            case TxType::VoucherRequest:
-            case TxType::VoucherResponse:
-            case TxType::InstantSbbsMessage:
-                continue;
-
-            case TxType::ALL:
-                assert(!"This should not happen");
-                continue;
-
-            case TxType::Contract:
-            case TxType::PushTransaction:
-            case TxType::Simple:
-            case TxType::DexSimpleSwap:
-                modifiedTransactions.push_back(std::make_shared<TxObject>(t, secondCurrency));
-                break;
-            }
+            _exportRequests.erase(it);
         }
+        return;
     }
+}
 
-    switch (action)
-    {
-        case ChangeAction::Reset:
-            {
-                _transactionsList.reset(modifiedTransactions);
-                break;
-            }
+void TxTableViewModel::onExportProgress(qint64 written, qint64 total)
+{
+    _exportProgress = total > 0 ? static_cast<double>(written) / total : 0.0;
+    emit exportStateChanged();
+}
 
-        case ChangeAction::Removed:
-            {
-                _transactionsList.remove(modifiedTransactions);
-                break;
-            }
+void TxTableViewModel::onExportFinished(TxHistoryExporter* exporter, bool succeeded)
+{
+    _txHistoryExports.removeOne(exporter);
+    exporter->deleteLater();
+    _exportProgress = 0.0;
+    emit exportStateChanged();
+    emit exportFinished(succeeded);
+}
 
-        case ChangeAction::Added:
-            {
-                _transactionsList.insert(modifiedTransactions);
-                break;
-            }
+void TxTableViewModel::onColumnsExportFinished(TxHistoryColumnsExporter* exporter, bool succeeded)
+{
+    _columnsExports.removeOne(exporter);
+    exporter->deleteLater();
+    _exportProgress = 0.0;
+    emit exportStateChanged();
+    emit exportFinished(succeeded);
+}
 
-        case ChangeAction::Updated:
-            {
-                _transactionsList.update(modifiedTransactions);
-                break;
-            }
+QAbstractItemModel* TxTableViewModel::getPagedTransactions()
+{
+    return &_pagedTransactions;
+}
 
-        default:
-            assert(false && "Unexpected action");
-            break;
-    }
+void TxTableViewModel::onLoadingProgress(int done, int total)
+{
+    _loadingProgress = total > 0 ? static_cast<double>(done) / total : 1.0;
+    emit loadingProgressChanged();
+}
 
-    emit transactionsChanged();
+void TxTableViewModel::onRateChanged()
+{
+    _pagedTransactions.setSecondCurrency(_rates->getRateCurrency());
+    _pagedTransactions.invalidateRates();
+    emit rateChanged();
 }
 
 QString TxTableViewModel::getRateUnit() const
@@ -243,6 +279,16 @@ QString TxTableViewModel::getRate() const
     return beamui::AmountToUIString(rate);
 }
 
+bool TxTableViewModel::isLoading() const
+{
+    return _pagedTransactions.isLoading();
+}
+
+double TxTableViewModel::getLoadingProgress() const
+{
+    return _loadingProgress;
+}
+
 bool TxTableViewModel::getShowInProgress() const
 {
     return _showInProgress;
@@ -252,9 +298,9 @@ void TxTableViewModel::setShowInProgress(bool value)
 {
     _showInProgress = value;
     _settings.setShowInProgress(value);
+    updatePagedQuery();
     emit showInProgressChanged();
     emit showAllChanged();
-    emit transactionsChanged();
 }
 
 bool TxTableViewModel::getShowCompleted() const
@@ -266,9 +312,9 @@ void TxTableViewModel::setShowCompleted(bool value)
 {
     _showCompleted = value;
     _settings.setShowCompleted(value);
+    updatePagedQuery();
     emit showCompletedChanged();
     emit showAllChanged();
-    emit transactionsChanged();
 }
 
 bool TxTableViewModel::getShowCanceled() const
@@ -280,9 +326,9 @@ void TxTableViewModel::setShowCanceled(bool value)
 {
     _showCanceled = value;
     _settings.setShowCanceled(value);
+    updatePagedQuery();
     emit showCanceledChanged();
     emit showAllChanged();
-    emit transactionsChanged();
 }
 
 bool TxTableViewModel::getShowFailed() const
@@ -294,9 +340,9 @@ void TxTableViewModel::setShowFailed(bool value)
 {
     _showFailed = value;
     _settings.setShowFailed(value);
+    updatePagedQuery();
     emit showFailedCanged();
     emit showAllChanged();
-    emit transactionsChanged();
 }
 
 bool TxTableViewModel::getShowAll() const
@@ -304,6 +350,124 @@ bool TxTableViewModel::getShowAll() const
     return _showInProgress && _showCompleted &&_showCanceled &&_showFailed;
 }
 
+QVector<beam::Asset::ID> TxTableViewModel::getAssetFilter() const
+{
+    const auto& assets = _pagedTransactions.getQuery().assets;
+    return QVector<beam::Asset::ID>(assets.begin(), assets.end());
+}
+
+void TxTableViewModel::setAssetFilter(const QVector<beam::Asset::ID>& value)
+{
+    std::vector<beam::Asset::ID> assets(value.begin(), value.end());
+    std::sort(assets.begin(), assets.end());
+    assets.erase(std::unique(assets.begin(), assets.end()), assets.end());
+
+    auto query = _pagedTransactions.getQuery();
+    query.assets = std::move(assets);
+    _pagedTransactions.setQuery(query);
+    emit filterChanged();
+    emit assetStatsChanged();
+}
+
+bool TxTableViewModel::getDexFilter() const
+{
+    return _pagedTransactions.getQuery().dexOnly;
+}
+
+void TxTableViewModel::setDexFilter(bool value)
+{
+    auto query = _pagedTransactions.getQuery();
+    query.dexOnly = value;
+    _pagedTransactions.setQuery(query);
+    emit filterChanged();
+}
+
+QString TxTableViewModel::getDappFilter() const
+{
+    return _pagedTransactions.getQuery().dappFilter;
+}
+
+void TxTableViewModel::setDappFilter(const QString& value)
+{
+    auto query = _pagedTransactions.getQuery();
+    query.dappFilter = value;
+    _pagedTransactions.setQuery(query);
+    emit filterChanged();
+}
+
+QString TxTableViewModel::getSearchFilter() const
+{
+    return _pagedTransactions.getQuery().searchText;
+}
+
+void TxTableViewModel::setSearchFilter(const QString& value)
+{
+    auto query = _pagedTransactions.getQuery();
+    query.searchText = value;
+    _pagedTransactions.setQuery(query);
+    emit filterChanged();
+}
+
+const AssetStats::Totals* TxTableViewModel::getSelectedAssetStats() const
+{
+    const auto& assets = _pagedTransactions.getQuery().assets;
+    return assets.size() == 1 ? &_assetStats->get(assets.front()) : nullptr;
+}
+
+bool TxTableViewModel::hasAssetStats() const
+{
+    return getSelectedAssetStats() != nullptr;
+}
+
+QString TxTableViewModel::getAssetSent() const
+{
+    const auto* stats = getSelectedAssetStats();
+    return stats ? beamui::AmountBigToUIString(stats->sent) : QString();
+}
+
+QString TxTableViewModel::getAssetReceived() const
+{
+    const auto* stats = getSelectedAssetStats();
+    return stats ? beamui::AmountBigToUIString(stats->received) : QString();
+}
+
+QString TxTableViewModel::getAssetFee() const
+{
+    const auto* stats = getSelectedAssetStats();
+    return stats ? beamui::AmountBigToUIString(stats->fee) : QString();
+}
+
+int TxTableViewModel::getAssetTxCount() const
+{
+    const auto* stats = getSelectedAssetStats();
+    return stats ? static_cast<int>(stats->txCount) : 0;
+}
+
+QDateTime TxTableViewModel::getAssetLastActivity() const
+{
+    const auto* stats = getSelectedAssetStats();
+    return stats && stats->lastActivity ? QDateTime::fromSecsSinceEpoch(stats->lastActivity) : QDateTime();
+}
+
+void TxTableViewModel::onAssetStatsChanged(beam::Asset::ID assetId)
+{
+    const auto& assets = _pagedTransactions.getQuery().assets;
+    if (assets.size() == 1 && assets.front() == assetId)
+    {
+        emit assetStatsChanged();
+    }
+}
+
+void TxTableViewModel::updatePagedQuery()
+{
+    auto query = _pagedTransactions.getQuery();
+    query.statusVisible[static_cast<size_t>(TxFilterStatus::InProgress)] = _showInProgress;
+    query.statusVisible[static_cast<size_t>(TxFilterStatus::Completed)] = _showCompleted;
+    query.statusVisible[static_cast<size_t>(TxFilterStatus::Canceled)] = _showCanceled;
+    query.statusVisible[static_cast<size_t>(TxFilterStatus::Failed)] = _showFailed;
+    _pagedTransactions.setQuery(query);
+}
+
 void TxTableViewModel::cancelTx(const QVariant& variantTxID)
 {
     if (!variantTxID.isNull() && variantTxID.isValid())
@@ -331,38 +495,3 @@ PaymentInfoItem* TxTableViewModel::getPaymentInfo(const QVariant& variantTxID)
     }
     else return Q_NULLPTR;
 }
-
-void TxTableViewModel::writeArchiveWithExportedTxData()
-{
-    const auto& path = _txHistoryToCsvPaths.dequeue();
-    QFile file(path);
-
-    QuaZip zip(file.fileName());
-    zip.open(QuaZip::mdCreate);
-
-    QuaZipFile zipFile(&zip);
-
-    if (zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo("transactions.csv")))
-    {
-        writeZipFile(zipFile, _txHistoryData);
-        zipFile.close();
-    }
-
-    if (zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo("atomic_swap_transactions.csv")))
-    {
-        writeZipFile(zipFile, _atomicSwapTxHistoryData);
-        zipFile.close();
-    }
-
-    if (zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo("assets_swap_transactions.csv")))
-    {
-        writeZipFile(zipFile, _assetsSwapTxHistoryData);
-        zipFile.close();
-    }
-
-    if (zipFile.open(QIODevice::WriteOnly, QuaZipNewInfo("contracts_transactions.csv")))
-    {
-        writeZipFile(zipFile, _contractTxHistoryData);
-        zipFile.close();
-    }
-}
@@ -16,28 +16,50 @@
 #include <QObject>
 #include <QQueue>
 #include <QAbstractItemModel>
+#include <QDateTime>
+#include <QPointer>
+#include <QSet>
 #include "model/wallet_model.h"
-#include "tx_object_list.h"
+#include "tx_paged_list.h"
+#include "tx_history_exporter.h"
+#include "tx_history_columns_exporter.h"
 #include "model/exchange_rates_manager.h"
+#include "model/asset_stats.h"
 #include "model/settings.h"
 
 class TxTableViewModel: public QObject {
     Q_OBJECT
-    Q_PROPERTY(QAbstractItemModel*  transactions READ getTransactions NOTIFY transactionsChanged)
+    Q_PROPERTY(QAbstractItemModel*  pagedTransactions READ getPagedTransactions CONSTANT)
     Q_PROPERTY(QString rateUnit     READ getRateUnit    NOTIFY rateChanged)
+    Q_PROPERTY(bool loading         READ isLoading          NOTIFY loadingProgressChanged)
+    Q_PROPERTY(double loadingProgress READ getLoadingProgress NOTIFY loadingProgressChanged)
     Q_PROPERTY(bool showInProgress  READ getShowInProgress WRITE setShowInProgress NOTIFY showInProgressChanged)
     Q_PROPERTY(bool showCompleted   READ getShowCompleted  WRITE setShowCompleted  NOTIFY showCompletedChanged)
     Q_PROPERTY(bool showCanceled    READ getShowCanceled   WRITE setShowCanceled   NOTIFY showCanceledChanged)
     Q_PROPERTY(bool showFailed      READ getShowFailed     WRITE setShowFailed     NOTIFY showFailedCanged)
     Q_PROPERTY(bool showAll         READ getShowAll                                NOTIFY showAllChanged)
+    Q_PROPERTY(QVector<beam::Asset::ID> assetFilter READ getAssetFilter WRITE setAssetFilter NOTIFY filterChanged)
+    Q_PROPERTY(bool dexFilter       READ getDexFilter      WRITE setDexFilter      NOTIFY filterChanged)
+    Q_PROPERTY(QString dappFilter   READ getDappFilter     WRITE setDappFilter     NOTIFY filterChanged)
+    Q_PROPERTY(QString searchFilter READ getSearchFilter   WRITE setSearchFilter   NOTIFY filterChanged)
+    Q_PROPERTY(bool hasAssetStats   READ hasAssetStats      NOTIFY assetStatsChanged)
+    Q_PROPERTY(QString assetSent    READ getAssetSent       NOTIFY assetStatsChanged)
+    Q_PROPERTY(QString assetReceived READ getAssetReceived  NOTIFY assetStatsChanged)
+    Q_PROPERTY(QString assetFee     READ getAssetFee        NOTIFY assetStatsChanged)
+    Q_PROPERTY(int assetTxCount     READ getAssetTxCount    NOTIFY assetStatsChanged)
+    Q_PROPERTY(QDateTime assetLastActivity READ getAssetLastActivity NOTIFY assetStatsChanged)
+    Q_PROPERTY(bool exporting       READ isExporting        NOTIFY exportStateChanged)
+    Q_PROPERTY(double exportProgress READ getExportProgress NOTIFY exportStateChanged)
 
 public:
     TxTableViewModel();
     ~TxTableViewModel() override = default;
 
-    QAbstractItemModel* getTransactions();
+    QAbstractItemModel* getPagedTransactions();
     QString getRateUnit() const;
     QString getRate() const;
+    bool isLoading() const;
+    double getLoadingProgress() const;
 
     bool getShowInProgress() const;
     void setShowInProgress(bool value);
@@ -48,49 +70,87 @@ public:
     bool getShowFailed() const;
     void setShowFailed(bool value);
     bool getShowAll() const;
+    QVector<beam::Asset::ID> getAssetFilter() const;
+    void setAssetFilter(const QVector<beam::Asset::ID>& value);
+    bool getDexFilter() const;
+    void setDexFilter(bool value);
+    QString getDappFilter() const;
+    void setDappFilter(const QString& value);
+    QString getSearchFilter() const;
+    void setSearchFilter(const QString& value);
+
+    // totals of the asset selected in assetFilter, empty unless exactly one asset is selected
+    bool hasAssetStats() const;
+    QString getAssetSent() const;
+    QString getAssetReceived() const;
+    QString getAssetFee() const;
+    int getAssetTxCount() const;
+    QDateTime getAssetLastActivity() const;
 
     Q_INVOKABLE void exportTxHistoryToCsv();
+    Q_INVOKABLE void exportTxHistoryToColumns();
+    Q_INVOKABLE void cancelExport();
+    bool isExporting() const;
+    double getExportProgress() const;
     Q_INVOKABLE void cancelTx(const QVariant& variantTxID);
     Q_INVOKABLE void deleteTx(const QVariant& variantTxID);
     Q_INVOKABLE PaymentInfoItem* getPaymentInfo(const QVariant& variantTxID);
 
 public slots:
-    void onTxHistoryExportedToCsv(const QString& data);
+    void onTxHistoryExportedToCsv(const QByteArray& data);
 #ifdef BEAM_ATOMIC_SWAP_SUPPORT
-    void onAtomicSwapTxHistoryExportedToCsv(const QString& data);
+    void onAtomicSwapTxHistoryExportedToCsv(const QByteArray& data);
 #endif // BEAM_ATOMIC_SWAP_SUPPORT
 #ifdef BEAM_ASSET_SWAP_SUPPORT
-    void onAssetsSwapTxHistoryExportedToCsv(const QString& data);
+    void onAssetsSwapTxHistoryExportedToCsv(const QByteArray& data);
 #endif  // BEAM_ASSET_SWAP_SUPPORT
-    void onContractTxHistoryExportedToCsv(const QString& data);
-    void onTransactionsChanged(beam::wallet::ChangeAction action, const std::vector<beam::wallet::TxDescription>& items);
+    void onContractTxHistoryExportedToCsv(const QByteArray& data);
+    void onRateChanged();
+    void onLoadingProgress(int done, int total);
 
 signals:
-    void transactionsChanged();
     void rateChanged();
     void showInProgressChanged();
     void showCompletedChanged();
     void showCanceledChanged();
     void showFailedCanged();
     void showAllChanged();
+    void filterChanged();
+    void assetStatsChanged();
+    void loadingProgressChanged();
+    void exportStateChanged();
+    void exportFinished(bool succeeded);
 
 private:
-    void writeArchiveWithExportedTxData();
+    // one per exportTxHistoryToCsv call, kept until the wallet has sent all of its parts
+    struct ExportRequest
+    {
+        QPointer<TxHistoryExporter> exporter;
+        QSet<QString> receivedParts;
+    };
+
+    void addExportedPart(const QString& name, const QByteArray& data);
+    void onExportProgress(qint64 written, qint64 total);
+    void onExportFinished(TxHistoryExporter* exporter, bool succeeded);
+    void requestColumnsPage(TxHistoryColumnsExporter* exporter, uint64_t start);
+    void onColumnsExportFinished(TxHistoryColumnsExporter* exporter, bool succeeded);
+    void updatePagedQuery();
+    void onAssetStatsChanged(beam::Asset::ID assetId);
+    const AssetStats::Totals* getSelectedAssetStats() const;
 
     WalletModel::Ptr     _model;
-    QQueue<QString>      _txHistoryToCsvPaths;
-    TxObjectList         _transactionsList;
-    TxObjectList         _transactionsListRejectedByFilter;
+    QQueue<TxHistoryExporter*> _txHistoryExports;
+    QQueue<ExportRequest> _exportRequests;
+    QQueue<TxHistoryColumnsExporter*> _columnsExports;
+    TxPagedList          _pagedTransactions;
     ExchangeRatesManager::Ptr _rates;
+    AssetStats::Ptr      _assetStats;
     WalletSettings&      _settings;
 
     bool _showInProgress = true;
     bool _showCompleted = true;
     bool _showCanceled = true;
     bool _showFailed = true;
-
-    QString _txHistoryData;
-    QString _atomicSwapTxHistoryData;
-    QString _assetsSwapTxHistoryData;
-    QString _contractTxHistoryData;
+    double _loadingProgress = 1.0;
+    double _exportProgress = 0.0;
 };